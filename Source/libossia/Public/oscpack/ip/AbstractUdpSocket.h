@@ -73,6 +73,13 @@ class SocketReceiveMultiplexer
       impl_.DetachSocketListener( socket, listener );
     }
 
+    // number of datagrams read per system call, where supported.
+    // must be called before Run
+    void SetReceiveBatchSize( int batchSize )
+    {
+      impl_.SetReceiveBatchSize( batchSize );
+    }
+
     void AttachPeriodicTimerListener( int periodMilliseconds, TimerListener *listener )
     {
       impl_.AttachPeriodicTimerListener( periodMilliseconds, listener );
@@ -163,6 +170,12 @@ class UdpSocket{
     {
         impl_.Send( data, size );
     }
+    // Send several datagrams to the connected endpoint, in as few system
+    // calls as the platform allows.
+    void SendMany( const char * const *data, const std::size_t *sizes, std::size_t count )
+    {
+        impl_.SendMany( data, sizes, count );
+    }
     void SendTo( const IpEndpointName& remoteEndpoint, const char *data, std::size_t size )
     {
         impl_.SendTo( remoteEndpoint, data, size );
@@ -225,6 +238,11 @@ class UdpListeningReceiveSocket : public UdpSocket<Impl_T>{
     { mux_.DetachSocketListener( &this->impl_, listener_ ); }
 
     // see SocketReceiveMultiplexer above for the behaviour of these methods...
+    void SetReceiveBatchSize( int batchSize ) { mux_.SetReceiveBatchSize( batchSize ); }
+    void AttachPeriodicTimerListener( int periodMilliseconds, TimerListener *listener )
+    { mux_.AttachPeriodicTimerListener( periodMilliseconds, listener ); }
+    void DetachPeriodicTimerListener( TimerListener *listener )
+    { mux_.DetachPeriodicTimerListener( listener ); }
     void Run() { mux_.Run(); }
     void Break() { mux_.Break(); }
     void AsynchronousBreak() { mux_.AsynchronousBreak(); }
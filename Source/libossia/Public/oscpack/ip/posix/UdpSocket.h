@@ -46,6 +46,9 @@
 #include <sys/socket.h>
 #include <sys/time.h>
 #include <netinet/in.h> // for sockaddr_in
+#if defined(__linux__)
+#include <sys/uio.h>
+#endif
 
 #include <signal.h>
 #include <math.h>
@@ -55,6 +58,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring> // for memset
+#include <memory>
 #include <stdexcept>
 #include <vector>
 
@@ -104,6 +108,11 @@ class UdpSocketImplementation{
     struct sockaddr_in sendToAddr_;
     int localPort_{};
 
+#if defined(__linux__)
+    std::vector< mmsghdr > sendHeaders_;
+    std::vector< iovec > sendIovecs_;
+#endif
+
 public:
 
     UdpSocketImplementation()
@@ -215,6 +224,50 @@ public:
         send( socket_, data, size, 0 );
     }
 
+    // Sends count datagrams to the connected endpoint.
+    // On Linux this is done with as few sendmmsg calls as possible.
+    void SendMany( const char * const *data, const std::size_t *sizes, std::size_t count )
+    {
+        assert( isConnected_ );
+
+#if defined(__linux__)
+        constexpr std::size_t max_per_call = UIO_MAXIOV;
+        while( count > 0 ){
+            const std::size_t n = std::min( count, max_per_call );
+            sendHeaders_.resize( n );
+            sendIovecs_.resize( n );
+            for( std::size_t i = 0; i < n; ++i ){
+                sendIovecs_[i].iov_base = const_cast<char*>( data[i] );
+                sendIovecs_[i].iov_len = sizes[i];
+                std::memset( &sendHeaders_[i], 0, sizeof(sendHeaders_[i]) );
+                sendHeaders_[i].msg_hdr.msg_iov = &sendIovecs_[i];
+                sendHeaders_[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            std::size_t sent = 0;
+            while( sent < n ){
+                int res = sendmmsg( socket_, sendHeaders_.data() + sent, n - sent, 0 );
+                if( res <= 0 ){
+                    if( res < 0 && errno == EINTR )
+                        continue;
+                    // sendmmsg stops at the first datagram that fails. Same policy
+                    // as Send: that one is dropped, and the next ones are still sent.
+                    sent += 1;
+                    continue;
+                }
+                sent += res;
+            }
+
+            data += n;
+            sizes += n;
+            count -= n;
+        }
+#else
+        for( std::size_t i = 0; i < count; ++i )
+            send( socket_, data[i], sizes[i], 0 );
+#endif
+    }
+
     void SendTo( const IpEndpointName& remoteEndpoint, const char *data, std::size_t size )
     {
         sendToAddr_.sin_addr.s_addr = htonl( remoteEndpoint.address );
@@ -255,6 +308,21 @@ public:
         return (std::size_t)result;
     }
 
+#if defined(__linux__)
+    // Receives up to vlen pending datagrams with a single recvmmsg call,
+    // without blocking. Returns the number of datagrams received.
+    int ReceiveMany( struct mmsghdr *msgs, unsigned int vlen )
+    {
+        assert( isBound_ );
+
+        int result = recvmmsg(socket_, msgs, vlen, MSG_DONTWAIT, nullptr);
+        if( result < 0 )
+            return 0;
+
+        return result;
+    }
+#endif
+
     int Socket() { return socket_; }
 };
 
@@ -271,6 +339,52 @@ struct AttachedTimerListener{
 };
 
 
+#if defined(__linux__)
+// Preallocated ring of packet buffers filled by a single recvmmsg call.
+struct ReceiveBatch{
+    ReceiveBatch( int count, int packetSize )
+        : packetSize_( packetSize )
+        , buffers_( (std::size_t)count * packetSize )
+        , headers_( count )
+        , iovecs_( count )
+        , addresses_( count )
+    {
+        for( int i = 0; i < count; ++i ){
+            iovecs_[i].iov_base = &buffers_[(std::size_t)i * packetSize];
+            iovecs_[i].iov_len = packetSize;
+        }
+    }
+
+    void Reset()
+    {
+        for( std::size_t i = 0; i < headers_.size(); ++i ){
+            std::memset( &headers_[i], 0, sizeof(headers_[i]) );
+            headers_[i].msg_hdr.msg_iov = &iovecs_[i];
+            headers_[i].msg_hdr.msg_iovlen = 1;
+            headers_[i].msg_hdr.msg_name = &addresses_[i];
+            headers_[i].msg_hdr.msg_namelen = sizeof(addresses_[i]);
+        }
+    }
+
+    unsigned int Count() const { return (unsigned int)headers_.size(); }
+    mmsghdr* Headers() { return headers_.data(); }
+
+    char* Data( int i ) { return &buffers_[(std::size_t)i * packetSize_]; }
+    std::size_t Size( int i ) const { return headers_[i].msg_len; }
+    IpEndpointName Endpoint( int i ) const
+    {
+        return IpEndpointName( ntohl( addresses_[i].sin_addr.s_addr ), ntohs( addresses_[i].sin_port ) );
+    }
+
+private:
+    int packetSize_{};
+    std::vector< char > buffers_;
+    std::vector< mmsghdr > headers_;
+    std::vector< iovec > iovecs_;
+    std::vector< sockaddr_in > addresses_;
+};
+#endif
+
 inline bool CompareScheduledTimerCalls(
         const std::pair< double, AttachedTimerListener > & lhs, const std::pair< double, AttachedTimerListener > & rhs )
 {
@@ -285,6 +399,7 @@ class SocketReceiveMultiplexerImplementation
 
     std::atomic_bool break_;
     int breakPipe_[2]; // [0] is the reader descriptor and [1] the writer
+    int receiveBatchSize_{1};
 
     double GetCurrentTimeMs() const
     {
@@ -323,6 +438,15 @@ public:
         socketListeners_.erase( i );
     }
 
+    // Maximum number of datagrams read with a single recvmmsg call each time
+    // a socket becomes readable. A size of 1 keeps the select() + recvfrom()
+    // behaviour.
+    // Only effective on Linux, and only read when Run() starts.
+    void SetReceiveBatchSize( int batchSize )
+    {
+        receiveBatchSize_ = std::max( batchSize, 1 );
+    }
+
     void AttachPeriodicTimerListener( int periodMilliseconds, TimerListener *listener )
     {
         timerListeners_.push_back( AttachedTimerListener( periodMilliseconds, periodMilliseconds, listener ) );
@@ -389,6 +513,12 @@ public:
             data = new char[ MAX_BUFFER_SIZE ];
             IpEndpointName remoteEndpoint;
 
+#if defined(__linux__)
+            std::unique_ptr< ReceiveBatch > batch;
+            if( receiveBatchSize_ > 1 )
+                batch = std::make_unique< ReceiveBatch >( receiveBatchSize_, MAX_BUFFER_SIZE );
+#endif
+
             struct timeval timeout;
 
             while( !break_ ){
@@ -435,6 +565,14 @@ public:
 
                     if( FD_ISSET( i->second->Socket(), &tempfds ) ){
 
+#if defined(__linux__)
+                        if( batch ){
+                            DrainSocket( *i->first, *i->second, *batch );
+                            if( break_ )
+                                break;
+                            continue;
+                        }
+#endif
                         std::size_t size = i->second->ReceiveFrom( remoteEndpoint, data, MAX_BUFFER_SIZE );
 
                         if(size == 8 && strcmp(data, "__stop_") == 0)
@@ -476,6 +614,35 @@ public:
         }
     }
 
+#if defined(__linux__)
+    // Reads one batch of pending datagrams, then hands each packet to the
+    // listener. Datagrams left in the socket make the next select() return
+    // immediately, after the timers which are due have been run: a sender
+    // flooding the socket does not starve them.
+    void DrainSocket( PacketListener& listener, UdpSocket_T& socket, ReceiveBatch& batch )
+    {
+        batch.Reset();
+        int count = socket.ReceiveMany( batch.Headers(), batch.Count() );
+
+        for( int k = 0; k < count; ++k ){
+            std::size_t size = batch.Size( k );
+            char* packet = batch.Data( k );
+
+            if(size == 8 && strcmp(packet, "__stop_") == 0)
+            {
+                break_ = true;
+                return;
+            }
+
+            if( size > 0 ){
+                listener.ProcessPacket( packet, (int)size, batch.Endpoint( k ) );
+                if( break_ )
+                    return;
+            }
+        }
+    }
+#endif
+
     void Break()
     {
         break_ = true;
@@ -214,6 +214,14 @@ public:
         send( socket_, data, (int)size, 0 );
   }
 
+  void SendMany( const char * const *data, const std::size_t *sizes, std::size_t count )
+  {
+    assert( isConnected_ );
+
+    for( std::size_t i = 0; i < count; ++i )
+      send( socket_, data[i], (int)sizes[i], 0 );
+  }
+
     void SendTo( const IpEndpointName& remoteEndpoint, const char *data, std::size_t size )
   {
     sendToAddr_.sin_addr.s_addr = htonl( remoteEndpoint.address );
@@ -315,6 +323,12 @@ public:
     socketListeners_.erase( i );
   }
 
+    // Batched reception is not available with winsock: packets are
+    // always read one at a time.
+    void SetReceiveBatchSize( int )
+    {
+    }
+
     void AttachPeriodicTimerListener( int periodMilliseconds, TimerListener *listener )
   {
     timerListeners_.push_back( AttachedTimerListener( periodMilliseconds, periodMilliseconds, listener ) );
@@ -1,9 +1,13 @@
 #pragma once
 #include <ossia/detail/config.hpp>
 
-#include <list>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <vector>
 
 /**
  * \file callback_container.hpp
@@ -39,43 +43,86 @@ template <typename T>
  *
  * This allows to cleanly stop listening when there are no callbacks.
  *
+ * The callbacks are stored in an immutable array, replaced by a new one
+ * when callbacks are added or removed: send() takes no lock, so callbacks
+ * can add or remove callbacks of the container they are called from.
+ *
+ * The arrays are reference counted with a split count: the sends which
+ * use the current array are counted in the upper bits of the word holding
+ * its pointer, and this count is moved to the array when it is replaced.
+ * A replaced array is freed by the last send() using it.
  */
 class callback_container
 {
+  struct entry
+  {
+    T callback;
+    uint64_t id{};
+  };
+  struct block;
+
 public:
+  /**
+   * @brief impl How the callbacks are stored.
+   * Callbacks are identified by a number, so that removing a callback
+   * does not invalidate the iterators to other callbacks.
+   */
+  using impl = std::vector<entry>;
+
+  //! Identifies a callback in the container
+  class iterator
+  {
+  public:
+    iterator() = default;
+    friend bool operator==(iterator lhs, iterator rhs) noexcept
+    {
+      return lhs.m_id == rhs.m_id;
+    }
+    friend bool operator!=(iterator lhs, iterator rhs) noexcept
+    {
+      return lhs.m_id != rhs.m_id;
+    }
+
+  private:
+    friend class callback_container;
+    explicit iterator(uint64_t id) noexcept : m_id{id}
+    {
+    }
+    uint64_t m_id{};
+  };
+
   callback_container() = default;
   callback_container(const callback_container& other)
   {
     std::lock_guard<std::mutex> lck{other.m_mutx};
-    m_callbacks = other.m_callbacks;
+    publish(impl{other.current()});
+    m_lastId = other.m_lastId;
   }
   callback_container(callback_container&& other) noexcept
   {
     std::lock_guard<std::mutex> lck{other.m_mutx};
-    m_callbacks = std::move(other.m_callbacks);
+    publish(impl{other.current()});
+    m_lastId = other.m_lastId;
   }
   callback_container& operator=(const callback_container& other)
   {
-    std::lock_guard<std::mutex> lck{other.m_mutx};
-    m_callbacks = other.m_callbacks;
+    if (this != &other)
+    {
+      std::scoped_lock lck{m_mutx, other.m_mutx};
+      publish(impl{other.current()});
+      m_lastId = other.m_lastId;
+    }
     return *this;
   }
   callback_container& operator=(callback_container&& other) noexcept
   {
-    std::lock_guard<std::mutex> lck{other.m_mutx};
-    m_callbacks = std::move(other.m_callbacks);
-    return *this;
+    return *this = static_cast<const callback_container&>(other);
   }
 
-  virtual ~callback_container() = default;
-
-  /**
-   * @brief impl How the callbackas are stored.
-   * A list is used since iterators to other callbacks
-   * must not be invalidated upon removal.
-   */
-  using impl = typename std::list<T>;
-  using iterator = typename impl::iterator;
+  virtual ~callback_container()
+  {
+    delete block_of(m_callbacks.load());
+  }
 
   /**
    * @brief add_callback Add a new callback.
@@ -88,8 +135,15 @@ public:
     if (cb)
     {
       std::lock_guard<std::mutex> lck{m_mutx};
-      auto it = m_callbacks.insert(m_callbacks.begin(), std::move(cb));
-      if (m_callbacks.size() == 1)
+      const auto& cur = current();
+      impl cbs;
+      cbs.reserve(cur.size() + 1);
+      cbs.push_back({std::move(cb), ++m_lastId});
+      cbs.insert(cbs.end(), cur.begin(), cur.end());
+
+      iterator it{m_lastId};
+      publish(std::move(cbs));
+      if (current().size() == 1)
         on_first_callback_added();
       return it;
     }
@@ -106,9 +160,9 @@ public:
   void remove_callback(iterator it)
   {
     std::lock_guard<std::mutex> lck{m_mutx};
-    if (m_callbacks.size() == 1)
+    if (current().size() == 1)
       on_removing_last_callback();
-    m_callbacks.erase(it);
+    publish(without(it));
   }
 
 
@@ -118,19 +172,23 @@ public:
   void replace_callback(iterator it, T&& cb)
   {
     std::lock_guard<std::mutex> lck{m_mutx};
-    *m_callbacks.erase(it, it) = std::move(cb);
+    impl cbs{current()};
+    for (auto& e : cbs)
+      if (e.id == it.m_id)
+        e.callback = std::move(cb);
+    publish(std::move(cbs));
   }
   void replace_callbacks(impl&& cbs)
   {
     std::lock_guard<std::mutex> lck{m_mutx};
-    m_callbacks = std::move(cbs);
+    publish(std::move(cbs));
   }
 
   class disabled_callback
   {
   public:
     explicit disabled_callback(callback_container& self)
-      : self{self}, old_callbacks{self.m_callbacks}
+      : self{self}, old_callbacks{self.current()}
     {
 
     }
@@ -152,7 +210,7 @@ public:
 
     // TODO should we also call on_removing_last_blah ?
     // I don't think so : it's supposed to be a short operation
-    m_callbacks.erase(it);
+    publish(without(it));
     return dis;
   }
 
@@ -163,7 +221,7 @@ public:
   std::size_t callback_count() const
   {
     std::lock_guard<std::mutex> lck{m_mutx};
-    return m_callbacks.size();
+    return current().size();
   }
 
   /**
@@ -173,21 +231,37 @@ public:
   bool callbacks_empty() const
   {
     std::lock_guard<std::mutex> lck{m_mutx};
-    return m_callbacks.empty();
+    return current().empty();
   }
 
   /**
    * @brief send Trigger all callbacks
    * @param args Arguments to send to the callbacks.
+   *
+   * Callbacks added or removed meanwhile take effect on the next call.
    */
   template <typename... Args>
   void send(Args&&... args)
   {
-    std::lock_guard<std::mutex> lck{m_mutx};
-    for (auto& callback : m_callbacks)
+    block* b = acquire();
+    if (!b)
+      return;
+
+    // Released even if a callback throws
+    struct guard
     {
-      if (callback)
-        callback(std::forward<Args>(args)...);
+      callback_container& self;
+      block* b;
+      ~guard()
+      {
+        self.release(b);
+      }
+    } g{*this, b};
+
+    for (auto& e : b->callbacks)
+    {
+      if (e.callback)
+        e.callback(args...);
     }
   }
 
@@ -197,9 +271,9 @@ public:
   void callbacks_clear()
   {
     std::lock_guard<std::mutex> lck{m_mutx};
-    if (!m_callbacks.empty())
+    if (!current().empty())
       on_removing_last_callback();
-    m_callbacks.clear();
+    publish({});
   }
 
 protected:
@@ -227,7 +301,101 @@ protected:
   }
 
 private:
-  impl m_callbacks;
+  struct block
+  {
+    impl callbacks;
+
+    // Sends moved from the word when the block was replaced, minus the sends
+    // which finished after that: the block is freed when it reaches zero.
+    std::atomic<int64_t> count{};
+  };
+
+  // The word holds the pointer in its lower bits, and the count of the sends
+  // using it in the upper ones.
+  static_assert(sizeof(void*) <= 8, "Pointers must fit in a 64-bit word");
+  static constexpr int pointer_bits = 48;
+  static constexpr uint64_t one_reader = uint64_t(1) << pointer_bits;
+  static constexpr uint64_t pointer_mask = one_reader - 1;
+
+  static block* block_of(uint64_t word) noexcept
+  {
+    return reinterpret_cast<block*>(uintptr_t(word & pointer_mask));
+  }
+
+  //! Counts a send of the current block, if any
+  block* acquire() noexcept
+  {
+    // Never counted on an empty container: the same null word could be
+    // seen again after callbacks are added and removed.
+    uint64_t word = m_callbacks.load(std::memory_order_acquire);
+    do
+    {
+      if (!block_of(word))
+        return nullptr;
+    } while (!m_callbacks.compare_exchange_weak(
+        word, word + one_reader, std::memory_order_acq_rel,
+        std::memory_order_acquire));
+    return block_of(word);
+  }
+
+  //! Ends a send of b
+  void release(block* b) noexcept
+  {
+    // b cannot have been freed and reallocated meanwhile, since this send
+    // still holds it: if the word has the same pointer, b is current.
+    uint64_t word = m_callbacks.load(std::memory_order_relaxed);
+    while (block_of(word) == b)
+    {
+      if (m_callbacks.compare_exchange_weak(
+              word, word - one_reader, std::memory_order_acq_rel,
+              std::memory_order_relaxed))
+        return;
+    }
+
+    // Replaced: publish() moved the count of this send to the block
+    if (b->count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      delete b;
+  }
+
+  //! The current callbacks. Requires m_mutx.
+  const impl& current() const noexcept
+  {
+    static const impl empty;
+    auto b = block_of(m_callbacks.load(std::memory_order_relaxed));
+    return b ? b->callbacks : empty;
+  }
+
+  //! The current callbacks without a given one. Requires m_mutx.
+  impl without(iterator it) const
+  {
+    const auto& cur = current();
+    impl cbs;
+    cbs.reserve(cur.size());
+    for (auto& e : cur)
+      if (e.id != it.m_id)
+        cbs.push_back(e);
+    return cbs;
+  }
+
+  //! Replaces the callbacks. Requires m_mutx.
+  void publish(impl&& cbs)
+  {
+    auto next = cbs.empty() ? nullptr : new block{std::move(cbs)};
+    assert((uintptr_t(next) & ~pointer_mask) == 0);
+    const auto prev = m_callbacks.exchange(
+        uint64_t(uintptr_t(next)), std::memory_order_acq_rel);
+
+    if (auto b = block_of(prev))
+    {
+      const auto readers = int64_t(prev >> pointer_bits);
+      if (b->count.fetch_add(readers, std::memory_order_acq_rel) == -readers)
+        delete b;
+    }
+  }
+
+  std::atomic<uint64_t> m_callbacks{};
+
   mutable std::mutex m_mutx;
+  uint64_t m_lastId{};
 };
 }
@@ -0,0 +1,156 @@
+#pragma once
+#include <atomic>
+#include <cinttypes>
+#include <utility>
+
+namespace ossia
+{
+/**
+ * @brief Copy-on-write pointer to an immutable value
+ *
+ * Copies share the value and only increment an atomic reference count.
+ * Const access never copies. Mutable access first makes the value unique
+ * to this pointer, copying it if it is shared.
+ *
+ * A mutable reference may outlive the access which returned it. Hence the
+ * value is then marked as unshareable, and copies of this pointer copy the
+ * value, until the pointer is moved : this is when the owner of the value
+ * gives it away, e.g. when a built list is moved into a parameter.
+ *
+ * The pointer is never null, except after being moved from : it then
+ * refers to an empty value.
+ */
+template <typename T>
+class cow_ptr
+{
+public:
+  explicit cow_ptr(const T& v) : m_block{new block{v}}
+  {
+  }
+
+  explicit cow_ptr(T&& v) : m_block{new block{std::move(v)}}
+  {
+  }
+
+  cow_ptr(const cow_ptr& other) : m_block{other.share()}
+  {
+  }
+
+  cow_ptr(cow_ptr&& other) noexcept
+      : m_block{std::exchange(other.m_block, nullptr)}
+  {
+    // An unshareable value is never shared, hence not read concurrently
+    if (m_block && !m_block->shareable)
+      m_block->shareable = true;
+  }
+
+  cow_ptr& operator=(const cow_ptr& other)
+  {
+    if (m_block != other.m_block)
+    {
+      auto b = other.share();
+      release();
+      m_block = b;
+    }
+    return *this;
+  }
+
+  cow_ptr& operator=(cow_ptr&& other) noexcept
+  {
+    if (this != &other)
+    {
+      release();
+      m_block = std::exchange(other.m_block, nullptr);
+      if (m_block && !m_block->shareable)
+        m_block->shareable = true;
+    }
+    return *this;
+  }
+
+  ~cow_ptr()
+  {
+    release();
+  }
+
+  const T& operator*() const noexcept
+  {
+    return m_block ? m_block->value : empty();
+  }
+
+  const T* operator->() const noexcept
+  {
+    return &**this;
+  }
+
+  //! Mutable access : copies the value if it is shared.
+  T& operator*()
+  {
+    if (!m_block)
+    {
+      m_block = new block{T{}};
+    }
+    else if (m_block->count.load(std::memory_order_acquire) != 1)
+    {
+      auto b = new block{m_block->value};
+      release();
+      m_block = b;
+    }
+
+    m_block->shareable = false;
+    return m_block->value;
+  }
+
+  T* operator->()
+  {
+    return &**this;
+  }
+
+  //! Number of pointers sharing the value
+  int32_t use_count() const noexcept
+  {
+    return m_block ? m_block->count.load(std::memory_order_relaxed) : 0;
+  }
+
+private:
+  struct block
+  {
+    explicit block(const T& v) : value(v)
+    {
+    }
+    explicit block(T&& v) : value(std::move(v))
+    {
+    }
+
+    std::atomic<int32_t> count{1};
+    bool shareable{true};
+    T value;
+  };
+
+  block* share() const
+  {
+    if (!m_block)
+      return nullptr;
+    if (!m_block->shareable)
+      return new block{m_block->value};
+
+    m_block->count.fetch_add(1, std::memory_order_relaxed);
+    return m_block;
+  }
+
+  void release() noexcept
+  {
+    if (m_block
+        && m_block->count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      delete m_block;
+    m_block = nullptr;
+  }
+
+  static const T& empty() noexcept
+  {
+    static const T e{};
+    return e;
+  }
+
+  block* m_block{};
+};
+}
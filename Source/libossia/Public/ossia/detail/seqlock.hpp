@@ -0,0 +1,77 @@
+#pragma once
+#include <atomic>
+#include <cinttypes>
+#include <cstring>
+#include <type_traits>
+
+namespace ossia
+{
+/**
+ * @brief Sequence lock around a small trivially copyable value
+ *
+ * Readers never block the writer: they copy the value and retry if a write
+ * happened meanwhile, detected by an odd or changed sequence number.
+ * The value is stored as atomic words, hence concurrent reads and writes
+ * are well-defined.
+ *
+ * There must be a single writer at a time: callers serialize the calls to
+ * store(), e.g. with the mutex which already guards the other state.
+ */
+template <typename T>
+class seqlock
+{
+  static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+  static constexpr std::size_t words = (sizeof(T) + 7) / 8;
+
+public:
+  seqlock() noexcept = default;
+  explicit seqlock(const T& v) noexcept
+  {
+    store(v);
+  }
+
+  seqlock(const seqlock&) = delete;
+  seqlock& operator=(const seqlock&) = delete;
+
+  void store(const T& v) noexcept
+  {
+    uint64_t buf[words]{};
+    std::memcpy(buf, &v, sizeof(T));
+
+    const auto seq = m_seq.load(std::memory_order_relaxed);
+    m_seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (std::size_t i = 0; i < words; i++)
+      m_data[i].store(buf[i], std::memory_order_relaxed);
+
+    m_seq.store(seq + 2, std::memory_order_release);
+  }
+
+  T load() const noexcept
+  {
+    uint64_t buf[words];
+    for (;;)
+    {
+      const auto seq = m_seq.load(std::memory_order_acquire);
+      if (seq & 1)
+        continue;
+
+      for (std::size_t i = 0; i < words; i++)
+        buf[i] = m_data[i].load(std::memory_order_relaxed);
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (m_seq.load(std::memory_order_relaxed) == seq)
+        break;
+    }
+
+    T v;
+    std::memcpy(&v, buf, sizeof(T));
+    return v;
+  }
+
+private:
+  std::atomic<uint64_t> m_seq{};
+  std::atomic<uint64_t> m_data[words]{};
+};
+}
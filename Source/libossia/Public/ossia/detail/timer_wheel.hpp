@@ -0,0 +1,177 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <utility>
+#include <vector>
+
+namespace ossia
+{
+/**
+ * @brief Hierarchical timer wheel
+ *
+ * Stores items until a deadline expressed in ticks, with O(1) insertion
+ * and an amortized O(1) cost per elapsed tick, whatever the number of
+ * pending items.
+ *
+ * The wheel has 4 levels of 256 slots: level 0 stores items due in the
+ * next 256 ticks, level 1 items due in the next 256² ticks, etc.
+ * When the lower level wraps, the matching slot of the upper level is
+ * cascaded down. Items further than 256⁴ ticks away are kept in the last
+ * level and re-inserted until they are due.
+ *
+ * The slots keep their storage, hence once the wheel has grown to its
+ * working size, scheduling items does not allocate.
+ *
+ * This class is not thread-safe.
+ */
+template <typename T>
+class timer_wheel
+{
+public:
+  using tick_t = uint64_t;
+
+  explicit timer_wheel(tick_t now = 0) noexcept : m_now{now}
+  {
+  }
+
+  //! Next tick that will be processed by advance()
+  tick_t now() const noexcept
+  {
+    return m_now;
+  }
+
+  std::size_t size() const noexcept
+  {
+    return m_size;
+  }
+
+  bool empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * @brief Schedules an item
+   *
+   * Items whose deadline is already past are returned by the next call to
+   * advance().
+   */
+  void insert(tick_t deadline, T item)
+  {
+    place(entry{deadline, std::move(item)});
+    m_size++;
+  }
+
+  /**
+   * @brief Processes all the ticks up to now (included)
+   *
+   * f(tick_t deadline, T&& item) is called for each expired item, in
+   * deadline order. f may insert new items in the wheel.
+   */
+  template <typename F>
+  void advance(tick_t now, F&& f)
+  {
+    while (m_now <= now)
+    {
+      if (m_size == 0)
+      {
+        m_now = now + 1;
+        return;
+      }
+
+      // Cascade the upper levels when the lower one wraps
+      for (std::size_t level = 1; level < levels; level++)
+      {
+        const auto shift = level * bits;
+        if (((m_now >> (shift - bits)) & mask) != 0)
+          break;
+
+        cascade(m_slots[level][(m_now >> shift) & mask]);
+      }
+
+      auto& slot = m_slots[0][m_now & mask];
+      if (!slot.empty())
+      {
+        m_expired.swap(slot);
+        for (auto& e : m_expired)
+        {
+          if (e.deadline > m_now)
+          {
+            // Was too far away to fit in the wheel
+            place(std::move(e));
+            continue;
+          }
+
+          m_size--;
+          f(e.deadline, std::move(e.item));
+        }
+        m_expired.clear();
+      }
+
+      m_now++;
+    }
+  }
+
+  //! Removes all the items
+  void clear()
+  {
+    for (auto& level : m_slots)
+      for (auto& slot : level)
+        slot.clear();
+    m_size = 0;
+  }
+
+private:
+  static constexpr std::size_t bits = 8;
+  static constexpr std::size_t slots = 1 << bits;
+  static constexpr std::size_t mask = slots - 1;
+  static constexpr std::size_t levels = 4;
+
+  struct entry
+  {
+    tick_t deadline;
+    T item;
+  };
+
+  void place(entry&& e)
+  {
+    // Past deadlines are due at the next tick
+    const tick_t due = std::max(e.deadline, m_now);
+    const tick_t delta = due - m_now;
+    for (std::size_t level = 0; level < levels; level++)
+    {
+      const auto shift = level * bits;
+      if (delta < (tick_t(1) << (shift + bits)))
+      {
+        m_slots[level][(due >> shift) & mask].push_back(std::move(e));
+        return;
+      }
+    }
+
+    // Beyond the range of the wheel: park the item at the farthest slot,
+    // it will be placed again once it is cascaded down.
+    constexpr auto top_shift = (levels - 1) * bits;
+    const tick_t farthest = m_now + (tick_t(1) << (top_shift + bits)) - 1;
+    m_slots[levels - 1][(farthest >> top_shift) & mask].push_back(
+        std::move(e));
+  }
+
+  void cascade(std::vector<entry>& slot)
+  {
+    if (slot.empty())
+      return;
+
+    m_cascade.swap(slot);
+    for (auto& e : m_cascade)
+      place(std::move(e));
+    m_cascade.clear();
+  }
+
+  std::array<std::array<std::vector<entry>, slots>, levels> m_slots;
+  std::vector<entry> m_expired;
+  std::vector<entry> m_cascade;
+  tick_t m_now{};
+  std::size_t m_size{};
+};
+}
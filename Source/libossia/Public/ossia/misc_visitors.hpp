@@ -128,11 +128,11 @@ auto apply(
       {
         case behavior_variant_type::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case behavior_variant_type::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         default:
           throw std::runtime_error("misc_visitors: bad type");
@@ -144,11 +144,11 @@ auto apply(
       {
         case behavior_variant_type::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case behavior_variant_type::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         default:
           throw std::runtime_error("misc_visitors: bad type");
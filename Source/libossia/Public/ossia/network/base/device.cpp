@@ -1,13 +1,23 @@
 // This is an open source non-commercial project. Dear PVS-Studio, please check
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <ossia/detail/algorithms.hpp>
 #include <ossia/network/base/device.hpp>
+#include <ossia/network/base/parameter.hpp>
 #include <ossia/network/base/protocol.hpp>
 
 namespace ossia
 {
 namespace net
 {
-device_base::~device_base() = default;
+// The device for which this thread creates a batch of learned nodes
+static thread_local const device_base* learned_batch_device{};
+
+device_base::~device_base()
+{
+  if (m_deferred)
+    on_parameter_removing
+        .disconnect<&device_base::pending_parameter_removed>(this);
+}
 
 device_base::device_base(std::unique_ptr<protocol_base> proto)
     : m_protocol{std::move(proto)}
@@ -18,5 +28,89 @@ protocol_base& device_base::get_protocol() const
 {
   return *m_protocol;
 }
+
+void device_base::begin_learned_batch() noexcept
+{
+  learned_batch_device = this;
+}
+
+void device_base::end_learned_batch() noexcept
+{
+  learned_batch_device = nullptr;
+}
+
+bool device_base::in_learned_batch() const noexcept
+{
+  return learned_batch_device == this;
+}
+
+void device_base::set_deferred_callbacks(bool b)
+{
+  if (b == m_deferred)
+    return;
+
+  if (b)
+  {
+    on_parameter_removing
+        .connect<&device_base::pending_parameter_removed>(this);
+    lock_t lck{m_pendingMutex};
+    m_deferred = true;
+  }
+  else
+  {
+    {
+      // No parameter can be marked as pending anymore once this is done:
+      // the removal handler is not needed after the last dispatch.
+      lock_t lck{m_pendingMutex};
+      m_deferred = false;
+    }
+    dispatch_pending();
+    on_parameter_removing
+        .disconnect<&device_base::pending_parameter_removed>(this);
+  }
+}
+
+bool device_base::mark_pending(parameter_base& p)
+{
+  lock_t lck{m_pendingMutex};
+  if (!m_deferred)
+    return false;
+  m_pending.push_back(&p);
+  return true;
+}
+
+void device_base::dispatch_pending()
+{
+  std::lock_guard<std::recursive_mutex> dispatch_lck{m_dispatchMutex};
+  {
+    lock_t lck{m_pendingMutex};
+    if (m_pending.empty())
+      return;
+    std::swap(m_pending, m_dispatching);
+  }
+
+  // Entries are set to null if their parameter is removed by a callback
+  for (std::size_t i = 0; i < m_dispatching.size(); i++)
+  {
+    if (auto p = m_dispatching[i])
+    {
+      // Cleared before reading the value : a change which happens
+      // afterwards is dispatched next time.
+      p->m_pending.store(false);
+      p->send(p->value());
+    }
+  }
+  m_dispatching.clear();
+}
+
+void device_base::pending_parameter_removed(const parameter_base& p)
+{
+  std::lock_guard<std::recursive_mutex> dispatch_lck{m_dispatchMutex};
+  lock_t lck{m_pendingMutex};
+  ossia::remove_erase(m_pending, &p);
+  for (auto& pending : m_dispatching)
+    if (pending == &p)
+      pending = nullptr;
+}
 }
 }
@@ -1,10 +1,15 @@
 #pragma once
+#include <ossia/detail/mutex.hpp>
 #include <ossia/network/base/node.hpp>
 #include <ossia/network/base/node_attributes.hpp>
 
 #include <nano_signal_slot.hpp>
 #include <ossia_export.h>
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 namespace ossia
 {
 namespace net
@@ -38,6 +43,11 @@ struct device_capabilities
  * - after a parameter has been created : device_base::on_parameter_created
  * - before a parameter is being removed : device_base::on_parameter_removing
  *
+ * - after a batch of nodes has been learned : device_base::on_nodes_learned
+ *
+ * The value callbacks of the parameters can also be deferred, see
+ * device_base::set_deferred_callbacks.
+ *
  * The root node of a device maps to the "/" address.
  *
  * A device is necessarily constructed with a protocol.
@@ -84,6 +94,26 @@ public:
     return get_root_node().get_name();
   }
 
+  /**
+   * @brief Defers the value callbacks of the parameters
+   *
+   * When enabled, a value change only marks its parameter as changed,
+   * and dispatch_pending() calls the callbacks of each changed parameter
+   * once, with its latest value : e.g. once per frame of the application,
+   * however many values were received meanwhile.
+   *
+   * Disabling it dispatches the pending changes.
+   */
+  void set_deferred_callbacks(bool);
+  bool get_deferred_callbacks() const noexcept
+  {
+    return m_deferred.load(std::memory_order_relaxed);
+  }
+
+  //! Calls the callbacks of the parameters changed since the last call.
+  //! Its cost only depends on the number of changed parameters.
+  void dispatch_pending();
+
   Nano::Signal<void(node_base&)>
       on_node_created; // The node being created
   Nano::Signal<void(node_base&)>
@@ -101,6 +131,18 @@ public:
   Nano::Signal<void(const std::string, const ossia::value& val)>
       on_unhandled_message; // A received value on a non-existing address
 
+  //! Called once for each batch of nodes created by a protocol learning
+  //! the namespace of a remote application, e.g. osc_protocol::set_learning,
+  //! with the created nodes, parents first. on_node_created and
+  //! on_parameter_created are not called for them.
+  Nano::Signal<void(const std::vector<node_base*>&)> on_nodes_learned;
+
+  //! While this thread creates a batch of learned nodes, the nodes and
+  //! parameters it creates are only signalled by on_nodes_learned.
+  void begin_learned_batch() noexcept;
+  void end_learned_batch() noexcept;
+  bool in_learned_batch() const noexcept;
+
   //! Called when a network client requests the creation of an instance.
   //!  First argument is the path to the parent.
   Nano::Signal<void(std::string, const parameter_data&)> on_add_node_requested;
@@ -117,6 +159,23 @@ public:
 protected:
   std::unique_ptr<ossia::net::protocol_base> m_protocol;
   device_capabilities m_capabilities;
+
+private:
+  friend class parameter_base;
+  //! False if the callbacks are not deferred anymore
+  bool mark_pending(parameter_base& p);
+  void pending_parameter_removed(const parameter_base& p);
+
+  std::atomic_bool m_deferred{};
+
+  // Parameters changed since the last dispatch, each one only once
+  ossia::mutex_t m_pendingMutex;
+  std::vector<parameter_base*> m_pending;
+
+  // Held while dispatching, so that parameters are not removed meanwhile.
+  // Recursive since callbacks may remove parameters.
+  std::recursive_mutex m_dispatchMutex;
+  std::vector<parameter_base*> m_dispatching;
 };
 
 template <typename T>
@@ -0,0 +1,17 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <ossia/network/base/encoded_message.hpp>
+#include <ossia/network/osc/detail/osc.hpp>
+
+namespace ossia
+{
+namespace net
+{
+const ossia::value& encoded_message::filtered()
+{
+  if (!m_filtered)
+    m_filtered = ossia::net::filter_value(parameter, value);
+  return *m_filtered;
+}
+}
+}
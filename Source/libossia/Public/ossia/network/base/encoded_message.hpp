@@ -0,0 +1,80 @@
+#pragma once
+#include <ossia/detail/optional.hpp>
+#include <ossia/detail/small_vector.hpp>
+#include <ossia/detail/string_view.hpp>
+#include <ossia/network/value/value.hpp>
+
+#include <ossia_export.h>
+
+#include <array>
+#include <cstdint>
+
+namespace ossia
+{
+namespace net
+{
+class parameter_base;
+
+/**
+ * @brief A value pushed through several protocols at once
+ *
+ * multiplex_protocol builds one for each push and gives it to all the
+ * protocols it exposes. The value is filtered once, and each encoding is
+ * only computed by the first protocol which needs it: e.g. all the OSC
+ * protocols send the same packet.
+ */
+class OSSIA_EXPORT encoded_message
+{
+public:
+  enum encoding : uint8_t
+  {
+    osc,          //! OSC message of osc_protocol and the OSC transports
+    oscquery_osc, //! OSC message of OSCQuery: OSC 1.1 types and units
+    encoding_count
+  };
+
+  using buffer = ossia::small_pod_vector<char, 512>;
+
+  encoded_message(const parameter_base& p, const ossia::value& v) noexcept
+      : parameter{p}, value{v}
+  {
+  }
+
+  encoded_message(const encoded_message&) = delete;
+  encoded_message(encoded_message&&) = delete;
+  encoded_message& operator=(const encoded_message&) = delete;
+  encoded_message& operator=(encoded_message&&) = delete;
+
+  const parameter_base& parameter;
+  const ossia::value& value;
+
+  //! The value after domain and parameter filtering, invalid if it must
+  //! not be sent. \see ossia::net::filter_value
+  const ossia::value& filtered();
+
+  //! Returns the bytes of an encoding of the message.
+  //! The first call for an encoding fills them with encode(buffer&).
+  template <typename F>
+  ossia::string_view get(encoding e, F&& encode)
+  {
+    auto& enc = m_encodings[e];
+    if (!enc.done)
+    {
+      encode(enc.bytes);
+      enc.done = true;
+    }
+    return {enc.bytes.data(), enc.bytes.size()};
+  }
+
+private:
+  struct cached_encoding
+  {
+    buffer bytes;
+    bool done{};
+  };
+
+  std::optional<ossia::value> m_filtered;
+  std::array<cached_encoding, encoding_count> m_encodings;
+};
+}
+}
@@ -3,6 +3,10 @@
 #include <ossia/detail/optional.hpp>
 #include <ossia/detail/string_map.hpp>
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
 namespace ossia
 {
 // MOVEME
@@ -80,10 +84,145 @@ private:
   map_type m_map;
 };
 
+/**
+ * @brief Map for frequent concurrent lookups and rare modifications
+ *
+ * Lookups never take a lock: they read the currently published version of
+ * the map. Modifications are serialized; each one copies the map, applies
+ * the change and publishes the new version, then waits until no reader can
+ * still be looking at the previous version before freeing it.
+ *
+ * Readers are tracked with two counters, one per epoch: a modification
+ * flips the epoch twice and waits for the readers of each epoch to drain.
+ */
+template <typename T>
+struct rcu_map
+{
+public:
+  using map_type = T;
+  using key_type = typename map_type::key_type;
+  using mapped_type = typename map_type::mapped_type;
+  using value_type = typename map_type::value_type;
+
+  rcu_map() : m_map{std::make_unique<map_type>()}
+  {
+    m_current.store(m_map.get());
+  }
+
+  rcu_map(const rcu_map&) = delete;
+  rcu_map(rcu_map&&) = delete;
+  rcu_map& operator=(const rcu_map&) = delete;
+  rcu_map& operator=(rcu_map&&) = delete;
+
+  template <typename K>
+  std::optional<mapped_type> find(const K& path) const
+  {
+    const int epoch = m_epoch.load();
+    m_readers[epoch].fetch_add(1);
+
+    std::optional<mapped_type> res;
+    const map_type& map = *m_current.load();
+    auto it = map.find(path);
+    if (it != map.end())
+      res = it->second;
+
+    m_readers[epoch].fetch_sub(1, std::memory_order_release);
+    return res;
+  }
+
+  std::optional<mapped_type> find_and_take(const key_type& path)
+  {
+    std::optional<mapped_type> res;
+    update([&](map_type& map) {
+      auto it = map.find(path);
+      if (it != map.end())
+      {
+        res = std::move(it.value());
+        map.erase(it);
+        return true;
+      }
+      return false;
+    });
+    return res;
+  }
+
+  void rename(const key_type& oldk, const key_type& newk)
+  {
+    update([&](map_type& map) {
+      auto it = map.find(oldk);
+      if (it != map.end())
+      {
+        auto v = it->second;
+        map.erase(it);
+        map.insert({newk, v});
+        return true;
+      }
+      return false;
+    });
+  }
+
+  void insert(const value_type& m)
+  {
+    update([&](map_type& map) {
+      map.insert(m);
+      return true;
+    });
+  }
+
+  void insert(value_type&& m)
+  {
+    update([&](map_type& map) {
+      map.insert(std::move(m));
+      return true;
+    });
+  }
+
+  void erase(const key_type& m)
+  {
+    update([&](map_type& map) { return map.erase(m) > 0; });
+  }
+
+private:
+  //! f applies a modification to a copy of the map and returns
+  //! false if nothing changed, in which case the copy is dropped.
+  template <typename F>
+  void update(F&& f)
+  {
+    lock_t lock(m_mutex);
+    auto next = std::make_unique<map_type>(*m_map);
+    if (!f(*next))
+      return;
+
+    m_current.store(next.get());
+
+    synchronize();
+    m_map = std::move(next);
+  }
+
+  // Waits until every reader which started before the last publication
+  // has finished.
+  void synchronize()
+  {
+    for (int i = 0; i < 2; i++)
+    {
+      const int old = m_epoch.load();
+      m_epoch.store(1 - old);
+      while (m_readers[old].load(std::memory_order_acquire) != 0)
+        std::this_thread::yield();
+    }
+  }
+
+  mutable std::atomic<int> m_readers[2]{};
+  std::atomic<int> m_epoch{};
+  std::atomic<const map_type*> m_current{};
+
+  mutex_t m_mutex;
+  std::unique_ptr<map_type> m_map;
+};
+
 namespace net
 {
 class parameter_base;
-using listened_parameters
-    = locked_map<string_map<ossia::net::parameter_base*>>;
+using listened_parameters = rcu_map<string_map<ossia::net::parameter_base*>>;
 }
 }
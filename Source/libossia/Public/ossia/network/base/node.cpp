@@ -78,10 +78,11 @@ node_base* node_base::create_child(std::string name)
     if ((ptr = res.get()))
     {
       m_children.push_back(std::move(res));
+      index_child(*ptr);
     }
   }
 
-  if (ptr)
+  if (ptr && !dev.in_learned_batch())
   {
     dev.on_node_created(*ptr);
   }
@@ -152,8 +153,10 @@ node_base* node_base::add_child(std::unique_ptr<node_base> n)
       {
         write_lock_t lock{m_mutex};
         m_children.push_back(std::move(n));
+        index_child(*ptr);
       }
-      dev.on_node_created(*ptr);
+      if (!dev.in_learned_batch())
+        dev.on_node_created(*ptr);
       return ptr;
     }
   }
@@ -166,6 +169,13 @@ node_base* node_base::find_child(ossia::string_view name)
     SPDLOG_TRACE((&ossia::logger()), "locking(findChild)");
     read_lock_t lock{m_mutex};
     SPDLOG_TRACE((&ossia::logger()), "locked(findChild)");
+    if (m_childIndex && m_childIndex->size() == m_children.size())
+    {
+      auto it = m_childIndex->find(name);
+      SPDLOG_TRACE((&ossia::logger()), "unlocked(findChild)");
+      return it != m_childIndex->end() ? it->second : nullptr;
+    }
+
     for (auto& node : m_children)
     {
       if (node->get_name() == name)
@@ -202,6 +212,41 @@ node_base* node_base::find_child(const QString& name)
 }
 #endif
 
+void node_base::index_child(node_base& child)
+{
+  if (m_childIndex)
+  {
+    m_childIndex->insert({child.get_name(), &child});
+  }
+  else if (m_children.size() >= child_index_threshold)
+  {
+    m_childIndex = std::make_unique<child_index_t>();
+    m_childIndex->reserve(m_children.size());
+  }
+
+  // Rebuild if the children were modified without going through
+  // create_child / add_child
+  if (m_childIndex && m_childIndex->size() != m_children.size())
+  {
+    m_childIndex->clear();
+    for (auto& cld : m_children)
+      m_childIndex->insert({cld->get_name(), cld.get()});
+  }
+}
+
+void node_base::on_child_renamed(
+    const node_base& child, const std::string& old_name)
+{
+  write_lock_t lock{m_mutex};
+  if (!m_childIndex)
+    return;
+
+  auto it = m_childIndex->find(old_name);
+  if (it != m_childIndex->end() && it->second == &child)
+    m_childIndex->erase(it);
+  m_childIndex->insert({child.get_name(), const_cast<node_base*>(&child)});
+}
+
 bool node_base::has_child(node_base& n)
 {
   SPDLOG_TRACE((&ossia::logger()), "locking(hasChild)");
@@ -229,6 +274,8 @@ bool node_base::remove_child(const std::string& name)
 
     if (it != m_children.end())
     {
+      if (m_childIndex)
+        m_childIndex->erase(n);
       cld = std::move(*it);
       m_children.erase(it);
     }
@@ -262,6 +309,8 @@ bool node_base::remove_child(const node_base& n)
 
     if (it != m_children.end())
     {
+      if (m_childIndex)
+        m_childIndex->erase(n.get_name());
       cld = std::move(*it);
       m_children.erase(it);
     }
@@ -292,6 +341,8 @@ void node_base::clear_children()
   {
     write_lock_t lock{m_mutex};
     to_remove = std::move(m_children);
+    m_children.clear();
+    m_childIndex.reset();
   }
 
   for (auto& child : to_remove)
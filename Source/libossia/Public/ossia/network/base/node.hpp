@@ -4,6 +4,7 @@
 #include <ossia/detail/locked_container.hpp>
 #include <ossia/detail/mutex.hpp>
 #include <ossia/detail/ptr_container.hpp>
+#include <ossia/detail/string_map.hpp>
 #include <ossia/detail/string_view.hpp>
 #include <ossia/network/base/name_validation.hpp>
 #include <ossia/network/common/parameter_properties.hpp>
@@ -158,6 +159,12 @@ public:
   //! Return true if this node is parent of this children
   bool has_child(ossia::net::node_base&);
 
+  /**
+   * @brief Must be called on the parent by implementations of set_name
+   * once the new name of a child is set.
+   */
+  void on_child_renamed(const node_base& child, const std::string& old_name);
+
   bool remove_child(const std::string& name);
   bool remove_child(const node_base& name);
 
@@ -209,6 +216,17 @@ protected:
   //! Reimplement for a specific removal action.
   virtual void removing_child(node_base& node_base) = 0;
 
+  //! Number of children past which find_child uses a hash index
+  static constexpr std::size_t child_index_threshold = 32;
+
+  //! Name -> child index. Null until the node has enough children.
+  //! The index is only used if it has as many entries as there are children,
+  //! so that implementations adding to m_children directly stay correct.
+  //! Must be accessed with m_mutex held.
+  using child_index_t = ossia::string_map<node_base*>;
+  std::unique_ptr<child_index_t> m_childIndex;
+  void index_child(node_base& child);
+
   std::string m_name;
   children_t m_children;
   mutable shared_mutex_t m_mutex;
@@ -420,6 +420,26 @@ void set_critical(ossia::net::parameter_data& n, critical v)
   n.critical = v;
 }
 
+ossia::string_view text_deadband()
+{
+  constexpr_return(ossia::make_string_view("deadband"));
+}
+std::optional<deadband> get_deadband(const ossia::net::node_base& n)
+{
+  if (auto addr = n.get_parameter())
+    return addr->get_deadband();
+  return std::nullopt;
+}
+void set_deadband(ossia::net::node_base& n, std::optional<deadband> v)
+{
+  if (auto addr = n.get_parameter())
+    addr->set_deadband(v);
+}
+void set_deadband(ossia::net::parameter_data& n, std::optional<deadband> v)
+{
+  n.deadband = v;
+}
+
 ossia::string_view text_repetition_filter()
 {
   constexpr_return(ossia::make_string_view("repetition_filter"));
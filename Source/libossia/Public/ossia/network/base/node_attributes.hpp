@@ -297,6 +297,14 @@ OSSIA_EXPORT critical get_critical(const ossia::net::node_base& n);
 OSSIA_EXPORT void set_critical(ossia::net::node_base& n, critical v);
 OSSIA_EXPORT void set_critical(ossia::net::parameter_data& n, critical v);
 
+OSSIA_EXPORT ossia::string_view text_deadband();
+OSSIA_EXPORT std::optional<deadband>
+get_deadband(const ossia::net::node_base& n);
+OSSIA_EXPORT void
+set_deadband(ossia::net::node_base& n, std::optional<deadband> v);
+OSSIA_EXPORT void
+set_deadband(ossia::net::parameter_data& n, std::optional<deadband> v);
+
 template <typename T>
 struct is_parameter_attribute : public std::false_type
 {
@@ -368,6 +376,7 @@ OSSIA_PARAM_ATTRIBUTE(ossia::value, default_value)
 OSSIA_PARAM_ATTRIBUTE(ossia::net::disabled, disabled)
 OSSIA_PARAM_ATTRIBUTE(ossia::net::muted, muted)
 OSSIA_PARAM_ATTRIBUTE(ossia::net::critical, critical)
+OSSIA_PARAM_ATTRIBUTE(ossia::deadband, deadband)
 
 // Metadata attributes
 OSSIA_ATTRIBUTE(ossia::net::tags, tags)
@@ -4,7 +4,10 @@
 #include <ossia/network/dataspace/value_with_unit.hpp>
 #include <ossia/network/generic/generic_node.hpp>
 #include <ossia/network/generic/generic_parameter.hpp>
+#include <ossia/network/base/value_history.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <future>
 #include <iostream>
 /*
@@ -15,6 +18,10 @@ namespace ossia
 {
 namespace net
 {
+parameter_base::parameter_base(ossia::net::node_base& n) : m_node{n}
+{
+}
+
 parameter_base::~parameter_base() = default;
 
 static void getAddressFromNode_rec(const node_base& n, std::string& str)
@@ -256,6 +263,102 @@ parameter_base& parameter_base::set_critical(bool v)
   return *this;
 }
 
+parameter_base&
+parameter_base::set_deadband(const std::optional<ossia::deadband>& v)
+{
+  if (m_deadband != v)
+  {
+    m_deadband = v;
+    m_node.get_device().on_attribute_modified(m_node, std::string(text_deadband()));
+  }
+  return *this;
+}
+
+void parameter_base::enable_history(std::size_t capacity)
+{
+  m_history = std::make_unique<value_history>(get_value_type(), capacity);
+}
+
+void parameter_base::disable_history()
+{
+  m_history.reset();
+}
+
+void parameter_base::notify(const ossia::value& v)
+{
+  if (m_history)
+    m_history->push(v);
+
+  auto& dev = m_node.get_device();
+  if (!dev.get_deferred_callbacks())
+  {
+    send(v);
+  }
+  else if (!callbacks_empty() && !m_pending.exchange(true))
+  {
+    // Only the first change since the last dispatch is recorded.
+    // Deferral may have been disabled meanwhile.
+    if (!dev.mark_pending(*this))
+    {
+      m_pending.store(false);
+      send(v);
+    }
+  }
+}
+
+static bool outside_deadband(const ossia::deadband& d, double last, double v)
+{
+  const auto threshold = std::max(d.absolute, d.relative * std::abs(last));
+  return std::abs(v - last) > threshold;
+}
+
+template <std::size_t N>
+static bool outside_deadband(
+    const ossia::deadband& d, const std::array<float, N>& last,
+    const std::array<float, N>& v)
+{
+  for (std::size_t i = 0; i < N; i++)
+    if (outside_deadband(d, last[i], v[i]))
+      return true;
+  return false;
+}
+
+bool outside_deadband(
+    const ossia::deadband& d, const ossia::value& last, const ossia::value& v)
+{
+  if (last.get_type() != v.get_type())
+    return true;
+
+  switch (v.get_type())
+  {
+    case ossia::val_type::FLOAT:
+      return outside_deadband(d, *last.target<float>(), *v.target<float>());
+    case ossia::val_type::INT:
+      return outside_deadband(d, *last.target<int32_t>(), *v.target<int32_t>());
+    case ossia::val_type::VEC2F:
+      return outside_deadband(d, *last.target<vec2f>(), *v.target<vec2f>());
+    case ossia::val_type::VEC3F:
+      return outside_deadband(d, *last.target<vec3f>(), *v.target<vec3f>());
+    case ossia::val_type::VEC4F:
+      return outside_deadband(d, *last.target<vec4f>(), *v.target<vec4f>());
+    case ossia::val_type::LIST:
+    {
+      auto& l = *last.target<std::vector<ossia::value>>();
+      auto& r = *v.target<std::vector<ossia::value>>();
+      if (l.size() != r.size())
+        return true;
+      for (std::size_t i = 0; i < r.size(); i++)
+        if (outside_deadband(d, l[i], r[i]))
+          return true;
+      return false;
+    }
+    case ossia::val_type::IMPULSE:
+      return true;
+    default:
+      return last != v;
+  }
+}
+
 value_with_unit get_value(const ossia::destination& d)
 {
   ossia::net::parameter_base& addr = d.value.get();
@@ -11,6 +11,7 @@
 #include <nano_signal_slot.hpp>
 #include <ossia_export.h>
 
+#include <atomic>
 #include <ciso646>
 #include <functional>
 #include <memory>
@@ -30,6 +31,7 @@ class value;
 namespace net
 {
 class node_base;
+class value_history;
 struct full_parameter_data;
 
 /**
@@ -44,9 +46,7 @@ struct full_parameter_data;
 class OSSIA_EXPORT parameter_base : public callback_container<value_callback>
 {
 public:
-  explicit parameter_base(ossia::net::node_base& n) : m_node{n}
-  {
-  }
+  explicit parameter_base(ossia::net::node_base& n);
   explicit parameter_base(const parameter_base&) = delete;
   explicit parameter_base(parameter_base&&) = delete;
   parameter_base& operator=(const parameter_base&) = delete;
@@ -179,15 +179,54 @@ public:
   bool get_critical() const;
   parameter_base& set_critical(bool v);
 
+  const std::optional<ossia::deadband>& get_deadband() const
+  {
+    return m_deadband;
+  }
+  parameter_base& set_deadband(const std::optional<ossia::deadband>& v);
+
+  /**
+   * @brief Records the last values of the parameter
+   *
+   * Allocates a value_history of the given capacity, of the current value
+   * type, in which each new value is then recorded with its date.
+   * This must not be called while the value or the history are accessed
+   * from other threads.
+   */
+  void enable_history(std::size_t capacity);
+  void disable_history();
+
+  //! The recorded values, null unless enable_history was called
+  const value_history* get_history() const noexcept
+  {
+    return m_history.get();
+  }
+
 protected:
+  //! Records a new value and calls the callbacks with it, or only marks the
+  //! parameter as changed when the device defers them.
+  //! \see device_base::set_deferred_callbacks
+  void notify(const ossia::value& v);
+
   ossia::net::node_base& m_node;
   unit_t m_unit;
   bool m_critical{};
   bool m_disabled{};
   bool m_muted{};
   ossia::repetition_filter m_repetitionFilter{ossia::repetition_filter::OFF};
+  std::optional<ossia::deadband> m_deadband;
+  std::unique_ptr<value_history> m_history;
+
+private:
+  friend class device_base;
+  std::atomic_bool m_pending{};
 };
 
+//! True if v differs from last by more than the deadband on any component.
+//! Values which are not numeric only have to be different.
+OSSIA_EXPORT bool outside_deadband(
+    const ossia::deadband& d, const ossia::value& last, const ossia::value& v);
+
 inline bool operator==(const parameter_base& lhs, const parameter_base& rhs)
 {
   return &lhs == &rhs;
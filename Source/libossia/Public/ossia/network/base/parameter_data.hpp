@@ -40,6 +40,7 @@ struct parameter_data
   std::optional<bool> disabled{};
   std::optional<bool> muted{};
   std::optional<bool> critical{};
+  std::optional<ossia::deadband> deadband;
   unit_t unit;
 
   extended_attributes extended;
@@ -1,5 +1,6 @@
 // This is an open source non-commercial project. Dear PVS-Studio, please check
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <ossia/network/base/encoded_message.hpp>
 #include <ossia/network/base/parameter.hpp>
 #include <ossia/network/base/parameter_data.hpp>
 #include <ossia/network/base/protocol.hpp>
@@ -33,6 +34,22 @@ bool protocol_base::push_bundle(
   return b;
 }
 
+bool protocol_base::push_bundle_values(
+    const std::vector<std::pair<const parameter_base*, ossia::value>>& v)
+{
+  bool b = !v.empty();
+  for (auto& [addr, val] : v)
+  {
+    b &= push(*addr, val);
+  }
+  return b;
+}
+
+bool protocol_base::push_encoded(encoded_message& msg)
+{
+  return push(msg.parameter, msg.value);
+}
+
 bool protocol_base::push_raw_bundle(
     const std::vector<ossia::net::full_parameter_data>& v)
 {
@@ -7,6 +7,7 @@
 
 #include <future>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace ossia
@@ -18,6 +19,7 @@ class parameter_base;
 class node_base;
 class device_base;
 struct full_parameter_data;
+class encoded_message;
 
 /**
  * @brief The protocol_base class
@@ -64,6 +66,25 @@ public:
   virtual bool
   push_bundle(const std::vector<const ossia::net::parameter_base*>&);
 
+  /**
+   * @brief Send many values in one go if the protocol supports it
+   *
+   * Unlike push_bundle, the values are given instead of being read from
+   * the parameters.
+   */
+  virtual bool push_bundle_values(
+      const std::vector<std::pair<const parameter_base*, ossia::value>>&);
+
+  /**
+   * @brief Send a value which is also sent through other protocols
+   *
+   * Protocols which encode values like others can reuse the encoding
+   * cached in the message. By default, calls push.
+   *
+   * \see multiplex_protocol
+   */
+  virtual bool push_encoded(encoded_message&);
+
   /**
    * @brief Send a value to the network.
    */
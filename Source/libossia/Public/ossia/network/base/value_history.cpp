@@ -0,0 +1,276 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <ossia/network/base/value_history.hpp>
+#include <ossia/network/value/value_conversion.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ossia
+{
+namespace net
+{
+static std::size_t lane_count(ossia::val_type t) noexcept
+{
+  switch (t)
+  {
+    case ossia::val_type::FLOAT:
+    case ossia::val_type::INT:
+    case ossia::val_type::BOOL:
+    case ossia::val_type::CHAR:
+      return 1;
+    case ossia::val_type::VEC2F:
+      return 2;
+    case ossia::val_type::VEC3F:
+      return 3;
+    case ossia::val_type::VEC4F:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+static bool interpolable(ossia::val_type t) noexcept
+{
+  switch (t)
+  {
+    case ossia::val_type::FLOAT:
+    case ossia::val_type::INT:
+    case ossia::val_type::VEC2F:
+    case ossia::val_type::VEC3F:
+    case ossia::val_type::VEC4F:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool stored_as_value(ossia::val_type t) noexcept
+{
+  return t == ossia::val_type::STRING || t == ossia::val_type::LIST
+         || t == ossia::val_type::NONE;
+}
+
+value_history::value_history(ossia::val_type type, std::size_t capacity)
+    : m_type{type}
+    , m_capacity{std::max(capacity, std::size_t(1))}
+    , m_lanes{lane_count(type)}
+{
+  m_times.resize(m_capacity);
+  m_data.resize(m_lanes * m_capacity);
+  if (stored_as_value(m_type))
+    m_values.resize(m_capacity);
+}
+
+value_history::~value_history() = default;
+
+std::size_t value_history::size() const
+{
+  lock_t lock(m_mutex);
+  return m_size;
+}
+
+void value_history::push(const ossia::value& v)
+{
+  lock_t lock(m_mutex);
+  record(clock::now(), v);
+}
+
+void value_history::push(clock::time_point t, const ossia::value& v)
+{
+  lock_t lock(m_mutex);
+  record(t, v);
+}
+
+void value_history::record(clock::time_point t, const ossia::value& v)
+{
+  if (m_size > 0)
+    t = std::max(t, m_times[slot(m_size - 1)]);
+
+  std::size_t s{};
+  if (m_size < m_capacity)
+  {
+    s = slot(m_size);
+    m_size++;
+  }
+  else
+  {
+    s = m_first;
+    m_first = slot(1);
+  }
+  m_times[s] = t;
+
+  const ossia::value* val = &v;
+  ossia::value converted;
+  if (v.get_type() != m_type && m_type != ossia::val_type::NONE)
+  {
+    converted = ossia::convert(v, m_type);
+    val = &converted;
+  }
+
+  float* lanes = m_data.data() + s;
+  auto set_lanes = [=](const auto& vec) {
+    for (std::size_t i = 0; i < vec.size(); i++)
+      lanes[i * m_capacity] = vec[i];
+  };
+
+  switch (m_type)
+  {
+    case ossia::val_type::FLOAT:
+      lanes[0] = val->get<float>();
+      break;
+    case ossia::val_type::INT:
+      lanes[0] = val->get<int32_t>();
+      break;
+    case ossia::val_type::BOOL:
+      lanes[0] = val->get<bool>();
+      break;
+    case ossia::val_type::CHAR:
+      lanes[0] = val->get<char>();
+      break;
+    case ossia::val_type::VEC2F:
+      set_lanes(val->get<ossia::vec2f>());
+      break;
+    case ossia::val_type::VEC3F:
+      set_lanes(val->get<ossia::vec3f>());
+      break;
+    case ossia::val_type::VEC4F:
+      set_lanes(val->get<ossia::vec4f>());
+      break;
+    case ossia::val_type::IMPULSE:
+      break;
+    default:
+      m_values[s] = *val;
+      break;
+  }
+}
+
+void value_history::clear()
+{
+  lock_t lock(m_mutex);
+  m_first = 0;
+  m_size = 0;
+  for (auto& v : m_values)
+    v = ossia::value{};
+}
+
+std::size_t value_history::lower_bound(clock::time_point t) const noexcept
+{
+  std::size_t first = 0;
+  std::size_t count = m_size;
+  while (count > 0)
+  {
+    const auto step = count / 2;
+    if (m_times[slot(first + step)] < t)
+    {
+      first += step + 1;
+      count -= step + 1;
+    }
+    else
+    {
+      count = step;
+    }
+  }
+  return first;
+}
+
+ossia::value value_history::from_lanes(const float* l) const
+{
+  switch (m_type)
+  {
+    case ossia::val_type::FLOAT:
+      return l[0];
+    case ossia::val_type::INT:
+      return int32_t(std::lround(l[0]));
+    case ossia::val_type::BOOL:
+      return l[0] != 0.f;
+    case ossia::val_type::CHAR:
+      return char(l[0]);
+    case ossia::val_type::VEC2F:
+      return ossia::vec2f{l[0], l[1]};
+    case ossia::val_type::VEC3F:
+      return ossia::vec3f{l[0], l[1], l[2]};
+    case ossia::val_type::VEC4F:
+      return ossia::vec4f{l[0], l[1], l[2], l[3]};
+    case ossia::val_type::IMPULSE:
+      return ossia::impulse{};
+    default:
+      return {};
+  }
+}
+
+ossia::value value_history::value_at(std::size_t s) const
+{
+  if (!m_values.empty())
+    return m_values[s];
+
+  float lanes[4];
+  for (std::size_t i = 0; i < m_lanes; i++)
+    lanes[i] = m_data[i * m_capacity + s];
+  return from_lanes(lanes);
+}
+
+ossia::value value_history::sample_at(clock::time_point t) const
+{
+  lock_t lock(m_mutex);
+  if (m_size == 0)
+    return {};
+
+  const auto i = lower_bound(t);
+  if (i == 0)
+    return value_at(slot(0));
+  if (i == m_size)
+    return value_at(slot(m_size - 1));
+
+  const auto next = slot(i);
+  const auto prev = slot(i - 1);
+  if (m_times[next] == t)
+    return value_at(next);
+  if (!interpolable(m_type))
+    return value_at(prev);
+
+  using seconds = std::chrono::duration<double>;
+  const double ratio = seconds(t - m_times[prev]).count()
+                       / seconds(m_times[next] - m_times[prev]).count();
+
+  float lanes[4];
+  for (std::size_t l = 0; l < m_lanes; l++)
+  {
+    const float a = m_data[l * m_capacity + prev];
+    const float b = m_data[l * m_capacity + next];
+    lanes[l] = float(a + (b - a) * ratio);
+  }
+  return from_lanes(lanes);
+}
+
+std::vector<value_history::sample>
+value_history::copy(std::size_t begin, std::size_t end) const
+{
+  std::vector<sample> res;
+  res.reserve(end - begin);
+  for (std::size_t i = begin; i < end; i++)
+  {
+    const auto s = slot(i);
+    res.push_back({m_times[s], value_at(s)});
+  }
+  return res;
+}
+
+std::vector<value_history::sample> value_history::get_range(
+    clock::time_point from, clock::time_point to) const
+{
+  lock_t lock(m_mutex);
+  const auto begin = lower_bound(from);
+  auto end = lower_bound(to);
+  while (end < m_size && m_times[slot(end)] == to)
+    end++;
+  return copy(begin, std::max(begin, end));
+}
+
+std::vector<value_history::sample> value_history::get_range() const
+{
+  lock_t lock(m_mutex);
+  return copy(0, m_size);
+}
+}
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include <ossia/detail/mutex.hpp>
+#include <ossia/network/common/parameter_properties.hpp>
+#include <ossia/network/value/value.hpp>
+
+#include <ossia_export.h>
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace ossia
+{
+namespace net
+{
+/**
+ * @brief The last values of a parameter, with their date
+ *
+ * A ring buffer of fixed capacity, allocated at construction : once full,
+ * each new value replaces the oldest one.
+ *
+ * The storage is a structure of arrays : the dates in one array, and the
+ * values of numbers, bools, chars and float vectors in one array of floats
+ * per component. Values of other types are stored as ossia::value.
+ * Values of another type than the history are converted to it.
+ *
+ * \see parameter_base::enable_history
+ */
+class OSSIA_EXPORT value_history
+{
+public:
+  using clock = std::chrono::steady_clock;
+
+  struct sample
+  {
+    clock::time_point time;
+    ossia::value value;
+  };
+
+  value_history(ossia::val_type type, std::size_t capacity);
+  ~value_history();
+
+  value_history(const value_history&) = delete;
+  value_history(value_history&&) = delete;
+  value_history& operator=(const value_history&) = delete;
+  value_history& operator=(value_history&&) = delete;
+
+  ossia::val_type get_type() const noexcept
+  {
+    return m_type;
+  }
+  std::size_t capacity() const noexcept
+  {
+    return m_capacity;
+  }
+  std::size_t size() const;
+
+  //! Records a value at the current date
+  void push(const ossia::value& v);
+
+  //! Records a value at a given date, e.g. when replaying values.
+  //! A date earlier than the newest sample is moved to its date.
+  void push(clock::time_point t, const ossia::value& v);
+
+  void clear();
+
+  /**
+   * @brief The value at a given date
+   *
+   * Floats, ints and float vectors are linearly interpolated between the
+   * samples surrounding t, other types give the latest sample before t.
+   * Outside of the recorded dates, gives the oldest or newest sample.
+   *
+   * @return An invalid value if the history is empty.
+   */
+  ossia::value sample_at(clock::time_point t) const;
+
+  //! A copy of the samples dated in [from, to], oldest first.
+  //! The history is only locked while they are copied.
+  std::vector<sample>
+  get_range(clock::time_point from, clock::time_point to) const;
+
+  //! A copy of all the samples, oldest first
+  std::vector<sample> get_range() const;
+
+private:
+  //! Slot of the i-th oldest sample
+  std::size_t slot(std::size_t i) const noexcept
+  {
+    return (m_first + i) % m_capacity;
+  }
+  void record(clock::time_point t, const ossia::value& v);
+  std::vector<sample> copy(std::size_t begin, std::size_t end) const;
+  //! First sample dated t or later
+  std::size_t lower_bound(clock::time_point t) const noexcept;
+  ossia::value value_at(std::size_t slot) const;
+  ossia::value from_lanes(const float* lanes) const;
+
+  mutable ossia::mutex_t m_mutex;
+  const ossia::val_type m_type{};
+  const std::size_t m_capacity{};
+  std::size_t m_lanes{};
+  std::size_t m_first{};
+  std::size_t m_size{};
+
+  std::vector<clock::time_point> m_times;
+  std::vector<float> m_data; // m_lanes lanes of m_capacity floats
+  std::vector<ossia::value> m_values;
+};
+}
+}
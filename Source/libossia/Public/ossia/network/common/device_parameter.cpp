@@ -63,7 +63,7 @@ net::parameter_base& device_parameter::set_value(const ossia::value& val)
   if (val.valid())
   {
     m_current_value = val;
-    send(val);
+    notify(val);
     device_update_value();
   }
 
@@ -13,6 +13,8 @@ namespace ossia
 {
 namespace net
 {
+class packet_logger;
+
 //! Stores custom loggers for the inbound and outbound network messages
 class OSSIA_EXPORT network_logger
 {
@@ -40,6 +42,14 @@ public:
   // Same but will only be active for parameters that are listened to.
   std::shared_ptr<spdlog::logger> inbound_listened_logger;
   std::shared_ptr<spdlog::logger> outbound_listened_logger;
+
+  /**
+   * @brief packet_log If set, the OSC protocols copy the raw packets to
+   * this logger, which formats them on its own thread, instead of
+   * formatting them with inbound_logger and outbound_logger on the network
+   * thread.
+   */
+  std::shared_ptr<packet_logger> packet_log;
 };
 }
 }
@@ -0,0 +1,266 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <ossia/detail/logger.hpp>
+#include <ossia/detail/murmur3.hpp>
+#include <ossia/detail/string_view.hpp>
+#include <ossia/network/common/packet_logger.hpp>
+
+#include <oscpack/osc/OscPrintReceivedElements.h>
+#include <oscpack/osc/OscReceivedElements.h>
+
+#include <fmt/ostream.h>
+
+#include <cstring>
+
+namespace ossia
+{
+namespace net
+{
+struct packet_logger::record
+{
+  std::atomic<std::size_t> sequence{};
+  std::chrono::system_clock::time_point time;
+  uint32_t size{};
+  direction dir{};
+  char data[max_record_size];
+};
+
+namespace
+{
+std::size_t ceil_pow2(std::size_t n)
+{
+  std::size_t res = 2;
+  while (res < n)
+    res *= 2;
+  return res;
+}
+
+// The address pattern is the first string of a message; bundles start
+// with "#bundle".
+std::size_t address_size(const char* data, std::size_t size) noexcept
+{
+  const void* end = std::memchr(data, '\0', size);
+  return end ? (const char*)end - data : size;
+}
+}
+
+packet_logger::packet_logger(
+    std::shared_ptr<spdlog::logger> inbound,
+    std::shared_ptr<spdlog::logger> outbound, std::size_t capacity)
+    : m_inbound{std::move(inbound)}, m_outbound{std::move(outbound)}
+{
+  capacity = ceil_pow2(capacity);
+  m_records = std::make_unique<record[]>(capacity);
+  m_mask = capacity - 1;
+  for (std::size_t i = 0; i < capacity; i++)
+    m_records[i].sequence.store(i, std::memory_order_relaxed);
+
+  m_thread = std::thread{[this] { run(); }};
+}
+
+packet_logger::~packet_logger()
+{
+  m_running = false;
+  m_thread.join();
+}
+
+void packet_logger::set_sampling(uint32_t n) noexcept
+{
+  m_sampling = std::max(n, uint32_t(1));
+}
+
+uint32_t packet_logger::sampling() const noexcept
+{
+  return m_sampling;
+}
+
+void packet_logger::set_rate_limit(uint32_t per_second) noexcept
+{
+  m_rateLimit = per_second;
+}
+
+uint32_t packet_logger::rate_limit() const noexcept
+{
+  return m_rateLimit;
+}
+
+uint64_t packet_logger::dropped() const noexcept
+{
+  return m_dropped.load(std::memory_order_relaxed);
+}
+
+uint64_t packet_logger::filtered() const noexcept
+{
+  return m_filtered.load(std::memory_order_relaxed);
+}
+
+bool packet_logger::accept(const char* data, std::size_t size) noexcept
+{
+  const auto n = m_sampling.load(std::memory_order_relaxed);
+  if (n > 1
+      && m_sampleCounter.fetch_add(1, std::memory_order_relaxed) % n != 0)
+    return false;
+
+  const auto limit = m_rateLimit.load(std::memory_order_relaxed);
+  if (limit > 0)
+  {
+    uint32_t hash = 0;
+    ossia::murmur::murmur3_x86_32(data, address_size(data, size), 0, hash);
+    auto& slot = m_rates[hash % m_rates.size()];
+
+    const auto now = uint32_t(std::chrono::duration_cast<std::chrono::seconds>(
+                         std::chrono::steady_clock::now().time_since_epoch())
+                         .count());
+    auto second = slot.second.load(std::memory_order_relaxed);
+    if (second != now
+        && slot.second.compare_exchange_strong(
+            second, now, std::memory_order_relaxed))
+      slot.count.store(0, std::memory_order_relaxed);
+
+    if (slot.count.fetch_add(1, std::memory_order_relaxed) >= limit)
+      return false;
+  }
+
+  return true;
+}
+
+void packet_logger::log(
+    direction dir, const char* data, std::size_t size) noexcept
+{
+  if (!accept(data, size))
+  {
+    m_filtered.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  // Bounded multiple-producer queue, see
+  // http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+  record* r{};
+  auto pos = m_enqueuePos.load(std::memory_order_relaxed);
+  for (;;)
+  {
+    r = &m_records[pos & m_mask];
+    const auto seq = r->sequence.load(std::memory_order_acquire);
+    const auto diff = intptr_t(seq) - intptr_t(pos);
+    if (diff == 0)
+    {
+      if (m_enqueuePos.compare_exchange_weak(
+              pos, pos + 1, std::memory_order_relaxed))
+        break;
+    }
+    else if (diff < 0)
+    {
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    else
+    {
+      pos = m_enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+
+  r->time = std::chrono::system_clock::now();
+  r->dir = dir;
+  r->size = uint32_t(size);
+  std::memcpy(r->data, data, std::min(size, max_record_size));
+  r->sequence.store(pos + 1, std::memory_order_release);
+}
+
+bool packet_logger::try_pop(record& out) noexcept
+{
+  auto& r = m_records[m_dequeuePos & m_mask];
+  if (r.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1)
+    return false;
+
+  out.time = r.time;
+  out.dir = r.dir;
+  out.size = r.size;
+  std::memcpy(out.data, r.data, std::min(std::size_t(r.size), max_record_size));
+
+  r.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+  m_dequeuePos++;
+  return true;
+}
+
+void packet_logger::run()
+{
+  auto r = std::make_unique<record>();
+  for (;;)
+  {
+    // Read the flag first so that the records logged before the
+    // destruction are still written.
+    const bool running = m_running;
+
+    bool empty = true;
+    while (try_pop(*r))
+    {
+      empty = false;
+      write(*r);
+    }
+
+    const auto dropped = m_dropped.load(std::memory_order_relaxed);
+    if (dropped != m_reportedDrops)
+    {
+      ossia::logger().warn(
+          "packet_logger: {} records dropped", dropped - m_reportedDrops);
+      m_reportedDrops = dropped;
+    }
+
+    if (!running)
+      break;
+    if (empty)
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+}
+
+void packet_logger::write(const record& r)
+{
+  const auto& logger = r.dir == inbound ? m_inbound : m_outbound;
+  if (!logger)
+    return;
+
+  const char* prefix = r.dir == inbound ? "In: " : "Out: ";
+  fmt::memory_buffer buf;
+  try
+  {
+    if (r.size > max_record_size)
+    {
+      fmt::format_to(
+          buf, "{}[{}] ({} bytes)", prefix,
+          ossia::string_view(r.data, address_size(r.data, max_record_size)),
+          r.size);
+    }
+    else
+    {
+      oscpack::ReceivedPacket p{r.data, (oscpack::osc_bundle_element_size_t)r.size};
+      if (p.IsBundle())
+      {
+        oscpack::ReceivedBundle b{p};
+        for (auto it = b.ElementsBegin(); it != b.ElementsEnd(); ++it)
+        {
+          if (it != b.ElementsBegin())
+            fmt::format_to(buf, "\n");
+          if (it->IsBundle())
+            fmt::format_to(buf, "{}[#bundle]", prefix);
+          else
+            fmt::format_to(buf, "{}{}", prefix, oscpack::ReceivedMessage{*it});
+        }
+      }
+      else
+      {
+        fmt::format_to(buf, "{}{}", prefix, oscpack::ReceivedMessage{p});
+      }
+    }
+  }
+  catch (const std::exception& e)
+  {
+    buf.clear();
+    fmt::format_to(buf, "{}invalid packet ({} bytes): {}", prefix, r.size, e.what());
+  }
+
+  logger->log(
+      r.time, spdlog::source_loc{}, spdlog::level::info,
+      spdlog::string_view_t(buf.data(), buf.size()));
+}
+}
+}
@@ -0,0 +1,117 @@
+#pragma once
+#include <ossia_export.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace spdlog
+{
+class logger;
+}
+
+namespace ossia
+{
+namespace net
+{
+/**
+ * @brief Logs network packets from a background thread
+ *
+ * The network threads only copy the raw bytes of the packets and a time
+ * stamp in a bounded, lock-free ring: formatting and writing to the spdlog
+ * loggers is done by a thread owned by the packet_logger.
+ * Packets are decoded as OSC messages or bundles; packets larger than
+ * max_record_size are truncated to their address.
+ *
+ * When the ring is full, records are dropped and counted: the count is
+ * available with dropped() and reported periodically in the log.
+ *
+ * To reduce the volume, only one packet in N can be logged
+ * (set_sampling), and the number of packets logged per second for a given
+ * address can be capped (set_rate_limit). The rate limit is tracked in a
+ * fixed table indexed by the hash of the address, hence addresses sharing
+ * a slot also share their budget.
+ *
+ * \see network_logger::packet_log
+ */
+class OSSIA_EXPORT packet_logger
+{
+public:
+  enum direction : uint8_t
+  {
+    inbound,
+    outbound
+  };
+
+  //! Bytes of a packet stored in a record
+  static constexpr std::size_t max_record_size = 512;
+
+  /**
+   * @param capacity Number of records in the ring, rounded up to a power
+   * of two.
+   */
+  packet_logger(
+      std::shared_ptr<spdlog::logger> inbound,
+      std::shared_ptr<spdlog::logger> outbound, std::size_t capacity = 1024);
+  ~packet_logger();
+
+  packet_logger(const packet_logger&) = delete;
+  packet_logger& operator=(const packet_logger&) = delete;
+
+  //! Copies a packet in the ring. Does not block nor allocate.
+  void log(direction dir, const char* data, std::size_t size) noexcept;
+
+  //! Log one packet out of n. 1 (the default) logs all the packets.
+  void set_sampling(uint32_t n) noexcept;
+  uint32_t sampling() const noexcept;
+
+  //! Maximum number of packets logged per second for an address.
+  //! 0 (the default) means no limit.
+  void set_rate_limit(uint32_t per_second) noexcept;
+  uint32_t rate_limit() const noexcept;
+
+  //! Records dropped because the ring was full
+  uint64_t dropped() const noexcept;
+
+  //! Packets skipped because of sampling or rate limiting
+  uint64_t filtered() const noexcept;
+
+private:
+  struct record;
+  struct rate_slot
+  {
+    std::atomic<uint32_t> second{};
+    std::atomic<uint32_t> count{};
+  };
+
+  bool accept(const char* data, std::size_t size) noexcept;
+  bool try_pop(record& r) noexcept;
+  void run();
+  void write(const record& r);
+
+  std::shared_ptr<spdlog::logger> m_inbound;
+  std::shared_ptr<spdlog::logger> m_outbound;
+
+  std::unique_ptr<record[]> m_records;
+  std::size_t m_mask{};
+  alignas(64) std::atomic<std::size_t> m_enqueuePos{};
+  alignas(64) std::size_t m_dequeuePos{};
+
+  alignas(64) std::atomic<uint32_t> m_sampling{1};
+  std::atomic<uint32_t> m_rateLimit{};
+  std::atomic<uint64_t> m_sampleCounter{};
+  std::array<rate_slot, 1024> m_rates;
+
+  std::atomic<uint64_t> m_dropped{};
+  std::atomic<uint64_t> m_filtered{};
+  uint64_t m_reportedDrops{};
+
+  std::atomic_bool m_running{true};
+  std::thread m_thread;
+};
+}
+}
@@ -59,4 +59,27 @@ enum repetition_filter : bool
   OFF = false,
   ON = true
 };
+
+/**
+ * @brief Minimal change of a value for it to be sent again by network
+ *
+ * Applies to each component of the numeric values, vecNf and lists.
+ * A change goes through when it is larger than the absolute threshold, or
+ * than the relative one times the magnitude of the value last sent, e.g.
+ * 0.01 for 1%.
+ */
+struct deadband
+{
+  double absolute{};
+  double relative{};
+
+  friend bool operator==(const deadband& lhs, const deadband& rhs) noexcept
+  {
+    return lhs.absolute == rhs.absolute && lhs.relative == rhs.relative;
+  }
+  friend bool operator!=(const deadband& lhs, const deadband& rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+};
 }
@@ -6,6 +6,7 @@
 #include <ossia/network/base/node_functions.hpp>
 #include <ossia/network/base/parameter.hpp>
 #include <ossia/network/common/path.hpp>
+#include <ossia/network/common/pattern_matcher.hpp>
 
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/predicate.hpp>
@@ -14,7 +15,8 @@
 
 #include <tsl/hopscotch_set.h>
 
-#include <regex>
+#include <memory>
+#include <mutex>
 
 namespace ossia
 {
@@ -84,13 +86,13 @@ void get_all_children(std::vector<ossia::net::node_base*>& vec)
   get_all_children_rec(vec, inserted);
 }
 
-void match_device_with_regex(
-    std::vector<ossia::net::node_base*>& vec, const std::regex& r)
+void match_device_with_pattern(
+    std::vector<ossia::net::node_base*>& vec, const pattern_matcher& r)
 {
   for (auto it = vec.cbegin(); it != vec.cend();)
   {
     const auto& name = (*it)->get_device().get_name();
-    if (!std::regex_match(name, r))
+    if (!r(name))
       it = vec.erase(it);
     else
       ++it;
@@ -109,8 +111,8 @@ void match_device_simple(
   }
 }
 
-void match_with_regex(
-    std::vector<ossia::net::node_base*>& vec, const std::regex& r)
+void match_with_pattern(
+    std::vector<ossia::net::node_base*>& vec, const pattern_matcher& r)
 {
   ossia::small_vector<ossia::net::node_base*, 16> old(vec.begin(), vec.end());
   vec.clear();
@@ -119,7 +121,7 @@ void match_with_regex(
   {
     for (auto& cld : node->children())
     {
-      if (std::regex_match(cld->get_name(), r))
+      if (r(cld->get_name()))
       {
         vec.push_back(cld.get());
       }
@@ -145,61 +147,37 @@ void match_simple(
   }
 }
 
-struct regex_cache
+struct pattern_cache
 {
-  static regex_cache& instance()
+  static pattern_cache& instance()
   {
-    static regex_cache c;
+    static pattern_cache c;
     return c;
   }
 
-  ossia::string_map<std::regex> map;
-  std::mutex mutex;
-};
-
-std::regex make_regex(std::string& part)
-{
-  // Perform the various regex-like replacements
-  // note: seriously, don't do this with regex if possible
-  net::expand_ranges(part);
-  std::string res = "^";
-  res.reserve(part.size() + 16);
-
-  static const auto qmark
-      = "[" + std::string(ossia::net::name_characters()) + "]?";
-  static const auto smark
-      = "[" + std::string(ossia::net::name_characters()) + "]*";
-  for (std::size_t i = 0, N = part.size(); i < N; i++)
+  std::shared_ptr<const pattern_matcher> get(const std::string& part)
   {
-    if (part[i] == '(')
-      res.append("\\(");
-    else if (part[i] == ')')
-      res.append("\\)");
-    else if (part[i] == '{')
-      res.append("(");
-    else if (part[i] == '}')
-      res.append(")");
-    else if (part[i] == ',')
-      res.append("|");
-    else if (part[i] == '?')
-      res.append(qmark);
-    else if (part[i] == '*')
-      res.append(smark);
-    else if (part[i] == '!')
-      res.append(regex_path::any_instance::instance_regex());
-    else
-      res += part[i];
+    std::lock_guard<std::mutex> _(mutex);
+
+    auto it = map.find(part);
+    if (it != map.end())
+      return it->second;
+
+    auto matcher = std::make_shared<const pattern_matcher>(part);
+    map.insert(std::make_pair(part, matcher));
+    return matcher;
   }
-  res += "$";
 
-  return std::regex{res};
-}
+  ossia::string_map<std::shared_ptr<const pattern_matcher>> map;
+  std::mutex mutex;
+};
 
-constexpr bool is_regex(std::string_view v)
+//! True if the part contains characters handled by pattern_matcher
+constexpr bool is_pattern_part(std::string_view v)
 {
   for(char c : v)
   {
-    if(c == '(' || c == '{' || c == '[' || c == '*' || c == '?' || c == '^' || c == '$' || c == '\\' || c == '/' || c == '.' || c == ',' || c == '!')
+    if(c == '{' || c == '}' || c == '[' || c == ']' || c == '*' || c == '?' || c == ',' || c == '!')
     {
       return true;
     }
@@ -210,29 +188,16 @@ constexpr bool is_regex(std::string_view v)
 void add_device_part(std::string part, path& p)
 {
   // TODO LRU cache
-  if(!is_regex(part))
+  if(!is_pattern_part(part))
   {
     p.child_functions.push_back([=, p = std::move(part)](auto& v) { match_device_simple(v, p); });
   }
   else
   {
-    auto& map = regex_cache::instance();
-    std::lock_guard<std::mutex> _(map.mutex);
-
-    auto it = map.map.find(part);
-    if (it != map.map.end())
-    {
-      p.child_functions.push_back(
-          [r = it->second](auto& v) { match_device_with_regex(v, r); });
-    }
-    else
-    {
-      std::string orig = part;
-
-      std::regex r = make_regex(part);
-      p.child_functions.push_back([=](auto& v) { match_device_with_regex(v, r); });
-      map.map.insert(std::make_pair(std::move(orig), std::move(r)));
-    }
+    p.child_functions.push_back(
+        [r = pattern_cache::instance().get(part)](auto& v) {
+          match_device_with_pattern(v, *r);
+        });
   }
 }
 
@@ -241,31 +206,17 @@ void add_relative_path(std::string& part, path& p)
   using namespace std::literals;
   if (part != ".."sv)
   {
-    if(!is_regex(part))
+    if(!is_pattern_part(part))
     {
       p.child_functions.push_back([p = std::move(part)](auto& v) { match_simple(v, p); });
     }
     else
     {
       // TODO LRU cache
-      auto& map = regex_cache::instance();
-      std::lock_guard<std::mutex> _(map.mutex);
-
-      auto it = map.map.find(part);
-      if (it != map.map.end())
-      {
-        p.child_functions.push_back(
-            [r = it->second](auto& v) { match_with_regex(v, r); });
-      }
-      else
-      {
-        std::string orig = part;
-
-        std::regex r = make_regex(part);
-
-        p.child_functions.push_back([=](auto& v) { match_with_regex(v, r); });
-        map.map.insert(std::make_pair(std::move(orig), std::move(r)));
-      }
+      p.child_functions.push_back(
+          [r = pattern_cache::instance().get(part)](auto& v) {
+            match_with_pattern(v, *r);
+          });
     }
   }
   else
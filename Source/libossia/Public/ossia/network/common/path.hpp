@@ -179,7 +179,7 @@ inline path_element operator/(const path_element& lhs, const stop& rhs)
  * buz:/{bee,boo}*
  *
  * We have a translation phase :
- * Let [:ossia:] be the regex character class defined by
+ * Let [:ossia:] be the character class defined by
  * ossia::net::name_characters()
  * "?"      -> [:ossia:]?
  * "*"      -> [:ossia:]*
@@ -187,10 +187,11 @@ inline path_element operator/(const path_element& lhs, const stop& rhs)
  * "//"     -> any_path() /
  * ".."     -> get_parent()
  * "{1..5}" -> get_range()
- * "[..]"   -> already handled by the regex engine.
+ * "[..]"   -> character class, "[!..]" is its complement
  * "{a,b}"  -> "(a|b)"
  *
- * All given paths are ended by "$"
+ * Each path part is compiled once into a \ref pattern_matcher which must
+ * match the whole node name.
  *
  * Given a path in the "user" format :
  * First try to find the largest absolute part from the beginning.
@@ -0,0 +1,102 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <ossia/network/base/device.hpp>
+#include <ossia/network/base/node.hpp>
+#include <ossia/network/base/node_functions.hpp>
+#include <ossia/network/common/pattern_match_cache.hpp>
+
+namespace ossia
+{
+namespace net
+{
+pattern_match_cache::pattern_match_cache(
+    ossia::net::device_base& dev, std::size_t capacity)
+    : m_device{dev}, m_capacity{std::max(capacity, std::size_t(1))}
+{
+  dev.on_node_created.connect<&pattern_match_cache::on_node_changed>(this);
+  dev.on_node_removing.connect<&pattern_match_cache::on_node_changed>(this);
+  dev.on_node_renamed.connect<&pattern_match_cache::on_node_renamed>(this);
+  dev.on_parameter_created
+      .connect<&pattern_match_cache::on_parameter_changed>(this);
+  dev.on_parameter_removing
+      .connect<&pattern_match_cache::on_parameter_changed>(this);
+  dev.on_nodes_learned.connect<&pattern_match_cache::on_nodes_learned>(this);
+}
+
+pattern_match_cache::~pattern_match_cache()
+{
+  auto& dev = m_device;
+  dev.on_node_created.disconnect<&pattern_match_cache::on_node_changed>(this);
+  dev.on_node_removing.disconnect<&pattern_match_cache::on_node_changed>(
+      this);
+  dev.on_node_renamed.disconnect<&pattern_match_cache::on_node_renamed>(
+      this);
+  dev.on_parameter_created
+      .disconnect<&pattern_match_cache::on_parameter_changed>(this);
+  dev.on_parameter_removing
+      .disconnect<&pattern_match_cache::on_parameter_changed>(this);
+  dev.on_nodes_learned.disconnect<&pattern_match_cache::on_nodes_learned>(
+      this);
+}
+
+std::shared_ptr<const pattern_match_cache::match>
+pattern_match_cache::find(ossia::string_view pattern)
+{
+  lock_t lock{m_mutex};
+  auto it = m_map.find(pattern);
+  if (it != m_map.end())
+  {
+    // Move to the front of the LRU list
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->result;
+  }
+
+  auto res = std::make_shared<match>();
+  auto nodes = ossia::net::find_nodes(m_device.get_root_node(), pattern);
+  res->found = !nodes.empty();
+  res->parameters.reserve(nodes.size());
+  for (auto n : nodes)
+  {
+    if (auto p = n->get_parameter())
+      res->parameters.push_back(p);
+  }
+
+  if (m_entries.size() >= m_capacity)
+  {
+    m_map.erase(m_entries.back().pattern);
+    m_entries.pop_back();
+  }
+
+  m_entries.push_front(entry{std::string(pattern), res});
+  m_map.insert({m_entries.front().pattern, m_entries.begin()});
+  return res;
+}
+
+void pattern_match_cache::clear()
+{
+  lock_t lock{m_mutex};
+  m_map.clear();
+  m_entries.clear();
+}
+
+void pattern_match_cache::on_node_changed(node_base&)
+{
+  clear();
+}
+
+void pattern_match_cache::on_node_renamed(node_base&, std::string)
+{
+  clear();
+}
+
+void pattern_match_cache::on_parameter_changed(const parameter_base&)
+{
+  clear();
+}
+
+void pattern_match_cache::on_nodes_learned(const std::vector<node_base*>&)
+{
+  clear();
+}
+}
+}
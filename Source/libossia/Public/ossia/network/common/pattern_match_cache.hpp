@@ -0,0 +1,76 @@
+#pragma once
+#include <ossia/detail/mutex.hpp>
+#include <ossia/detail/string_map.hpp>
+#include <ossia/detail/string_view.hpp>
+
+#include <ossia_export.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ossia
+{
+namespace net
+{
+class device_base;
+class node_base;
+class parameter_base;
+
+/**
+ * @brief LRU cache of the parameters matched by OSC patterns
+ *
+ * Used when handling inbound messages with a pattern address such as
+ * `/lights/ * /intensity`: the first message resolves the pattern with
+ * ossia::net::find_nodes, the following ones only cost a hash lookup.
+ *
+ * The whole cache is invalidated whenever the tree of the device changes
+ * (node or parameter creation, removal, renaming).
+ */
+class OSSIA_EXPORT pattern_match_cache
+{
+public:
+  struct match
+  {
+    std::vector<ossia::net::parameter_base*> parameters;
+
+    //! False if no node at all matched the pattern
+    bool found{};
+  };
+
+  explicit pattern_match_cache(
+      ossia::net::device_base& dev, std::size_t capacity = 128);
+  ~pattern_match_cache();
+
+  pattern_match_cache(const pattern_match_cache&) = delete;
+  pattern_match_cache(pattern_match_cache&&) = delete;
+  pattern_match_cache& operator=(const pattern_match_cache&) = delete;
+  pattern_match_cache& operator=(pattern_match_cache&&) = delete;
+
+  std::shared_ptr<const match> find(ossia::string_view pattern);
+
+  void clear();
+
+private:
+  void on_node_changed(ossia::net::node_base&);
+  void on_node_renamed(ossia::net::node_base&, std::string);
+  void on_parameter_changed(const ossia::net::parameter_base&);
+  void on_nodes_learned(const std::vector<ossia::net::node_base*>&);
+
+  struct entry
+  {
+    std::string pattern;
+    std::shared_ptr<const match> result;
+  };
+
+  ossia::net::device_base& m_device;
+  std::size_t m_capacity{};
+
+  ossia::mutex_t m_mutex;
+  // Most recently used first. The map keys point into the list entries.
+  std::list<entry> m_entries;
+  ossia::string_view_map<std::list<entry>::iterator> m_map;
+};
+}
+}
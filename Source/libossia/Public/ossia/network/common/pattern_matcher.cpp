@@ -0,0 +1,269 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <ossia/network/base/name_validation.hpp>
+#include <ossia/network/base/node_functions.hpp>
+#include <ossia/network/common/pattern_matcher.hpp>
+#include <ossia/network/exceptions.hpp>
+
+#include <limits>
+
+namespace ossia
+{
+namespace traversal
+{
+namespace
+{
+using token = pattern_matcher::token;
+using sequence = pattern_matcher::sequence;
+using alternatives = std::vector<sequence>;
+
+// Patterns such as {a,b}{c,d}{e,f}... grow exponentially once expanded
+constexpr std::size_t max_alternatives = 1024;
+constexpr uint32_t unbounded = std::numeric_limits<uint32_t>::max();
+
+// Parses a character class body in the regex syntax used by
+// ossia::net::name_characters(), e.g. "a-zA-Z0-9_~(): .-"
+std::bitset<256> make_charset(ossia::string_view spec)
+{
+  std::bitset<256> res;
+  for (std::size_t i = 0; i < spec.size(); i++)
+  {
+    const auto c = (unsigned char)spec[i];
+    if (i + 2 < spec.size() && spec[i + 1] == '-')
+    {
+      const auto last = (unsigned char)spec[i + 2];
+      for (unsigned int k = c; k <= last; k++)
+        res.set(k);
+      i += 2;
+    }
+    else
+    {
+      res.set(c);
+    }
+  }
+  return res;
+}
+
+const std::bitset<256>& name_charset()
+{
+  static const auto set = make_charset(ossia::net::name_characters());
+  return set;
+}
+
+const std::bitset<256>& instance_charset()
+{
+  static const auto set
+      = make_charset(ossia::net::name_characters_no_instance());
+  return set;
+}
+
+void append(sequence& seq, token t)
+{
+  // Merge consecutive literal characters
+  if (!t.literal.empty() && !seq.empty() && !seq.back().literal.empty())
+    seq.back().literal += t.literal;
+  else
+    seq.push_back(std::move(t));
+}
+
+void append(alternatives& alts, const token& t)
+{
+  for (auto& seq : alts)
+    append(seq, t);
+}
+
+alternatives product(const alternatives& lhs, const alternatives& rhs)
+{
+  if (lhs.size() * rhs.size() > max_alternatives)
+    throw ossia::parse_error{"pattern_matcher: too many alternatives"};
+
+  alternatives res;
+  res.reserve(lhs.size() * rhs.size());
+  for (const auto& l : lhs)
+  {
+    for (const auto& r : rhs)
+    {
+      sequence seq = l;
+      for (const auto& t : r)
+        append(seq, t);
+      res.push_back(std::move(seq));
+    }
+  }
+  return res;
+}
+
+token literal(char c)
+{
+  token t;
+  t.literal = c;
+  return t;
+}
+
+token repeat(const std::bitset<256>& chars, uint32_t min, uint32_t max)
+{
+  token t;
+  t.chars = chars;
+  t.min = min;
+  t.max = max;
+  return t;
+}
+
+// Parses a [...] class, pos is just after the opening bracket
+token parse_class(ossia::string_view str, std::size_t& pos)
+{
+  const auto end = str.find(']', pos);
+  if (end == ossia::string_view::npos)
+    throw ossia::parse_error{"pattern_matcher: unterminated ["};
+
+  auto spec = str.substr(pos, end - pos);
+  bool negate = false;
+  if (!spec.empty() && (spec[0] == '!' || spec[0] == '^'))
+  {
+    negate = true;
+    spec.remove_prefix(1);
+  }
+
+  auto set = make_charset(spec);
+  if (negate)
+    set.flip();
+
+  pos = end + 1;
+  return repeat(set, 1, 1);
+}
+
+alternatives parse(ossia::string_view str, std::size_t& pos, bool in_group)
+{
+  alternatives res;
+  alternatives cur(1);
+
+  while (pos < str.size())
+  {
+    const char c = str[pos];
+    if (c == '}' && in_group)
+      break;
+
+    switch (c)
+    {
+      case ',':
+        // Outside of braces, this behaves as an alternative over
+        // the whole pattern
+        res.insert(res.end(), cur.begin(), cur.end());
+        cur.assign(1, {});
+        pos++;
+        break;
+      case '{':
+      {
+        pos++;
+        auto sub = parse(str, pos, true);
+        if (pos >= str.size() || str[pos] != '}')
+          throw ossia::parse_error{"pattern_matcher: unterminated {"};
+        pos++;
+        cur = product(cur, sub);
+        break;
+      }
+      case '}':
+        // Closing braces of groups are consumed above
+        throw ossia::parse_error{"pattern_matcher: unbalanced }"};
+      case '[':
+        pos++;
+        append(cur, parse_class(str, pos));
+        break;
+      case '?':
+        pos++;
+        append(cur, repeat(name_charset(), 0, 1));
+        break;
+      case '*':
+        pos++;
+        append(cur, repeat(name_charset(), 0, unbounded));
+        break;
+      case '!':
+      {
+        pos++;
+        // Either no instance, or '.' followed by the instance number / name
+        alternatives instance(2);
+        instance[1].push_back(literal('.'));
+        instance[1].push_back(repeat(instance_charset(), 1, unbounded));
+        cur = product(cur, instance);
+        break;
+      }
+      default:
+        pos++;
+        append(cur, literal(c));
+        break;
+    }
+  }
+
+  res.insert(res.end(), cur.begin(), cur.end());
+  if (res.size() > max_alternatives)
+    throw ossia::parse_error{"pattern_matcher: too many alternatives"};
+  return res;
+}
+
+bool match(
+    const token* tok, const token* tok_end, const char* str,
+    const char* str_end) noexcept
+{
+  for (; tok != tok_end; ++tok)
+  {
+    const std::size_t remaining = str_end - str;
+    if (!tok->literal.empty())
+    {
+      const auto& lit = tok->literal;
+      if (remaining < lit.size()
+          || std::char_traits<char>::compare(str, lit.data(), lit.size()) != 0)
+        return false;
+      str += lit.size();
+    }
+    else if (tok->min == 1 && tok->max == 1)
+    {
+      if (remaining == 0 || !tok->chars.test((unsigned char)*str))
+        return false;
+      ++str;
+    }
+    else
+    {
+      // Greedy match, then backtrack
+      std::size_t n = 0;
+      while (n < remaining && n < tok->max
+             && tok->chars.test((unsigned char)str[n]))
+        ++n;
+
+      if (n < tok->min)
+        return false;
+
+      for (std::size_t k = n + 1; k-- > tok->min;)
+      {
+        if (match(tok + 1, tok_end, str + k, str_end))
+          return true;
+      }
+      return false;
+    }
+  }
+
+  return str == str_end;
+}
+}
+
+pattern_matcher::pattern_matcher(ossia::string_view pattern)
+    : m_pattern{pattern}
+{
+  std::string expanded{pattern};
+  ossia::net::expand_ranges(expanded);
+
+  std::size_t pos = 0;
+  m_alternatives = parse(expanded, pos, false);
+}
+
+bool pattern_matcher::operator()(ossia::string_view name) const noexcept
+{
+  const char* begin = name.data();
+  const char* end = begin + name.size();
+  for (const auto& seq : m_alternatives)
+  {
+    if (match(seq.data(), seq.data() + seq.size(), begin, end))
+      return true;
+  }
+  return false;
+}
+}
+}
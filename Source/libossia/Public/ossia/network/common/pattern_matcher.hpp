@@ -0,0 +1,64 @@
+#pragma once
+#include <ossia/detail/string_view.hpp>
+
+#include <ossia_export.h>
+
+#include <bitset>
+#include <cinttypes>
+#include <string>
+#include <vector>
+
+namespace ossia
+{
+namespace traversal
+{
+/**
+ * @brief Matches node names against an OSC pattern
+ *
+ * The pattern is compiled once into a list of alternatives made of literal
+ * strings and repeated character classes, which can then be matched against
+ * any number of names without further allocation.
+ *
+ * Supported syntax, as documented in \ref ossia::traversal :
+ * - "?"      : zero or one name character
+ * - "*"      : any number of name characters
+ * - "!"      : an optional instance suffix, e.g. ".12"
+ * - "[abc]", "[a-z]", "[!a-z]" : character classes
+ * - "{a,b}"  : alternatives, which may be nested and contain patterns
+ * - "{1..5..1}" : numeric ranges, expanded with ossia::net::expand_ranges
+ *
+ * Every other character is matched literally.
+ *
+ * @throws ossia::parse_error if the pattern is malformed.
+ */
+class OSSIA_EXPORT pattern_matcher
+{
+public:
+  explicit pattern_matcher(ossia::string_view pattern);
+
+  //! True if the whole name matches the pattern
+  bool operator()(ossia::string_view name) const noexcept;
+
+  const std::string& pattern() const noexcept
+  {
+    return m_pattern;
+  }
+
+  struct token
+  {
+    //! If not empty, the token matches this exact string
+    std::string literal;
+
+    //! Else, it matches between min and max characters of this set
+    std::bitset<256> chars;
+    uint32_t min{1};
+    uint32_t max{1};
+  };
+  using sequence = std::vector<token>;
+
+private:
+  std::string m_pattern;
+  std::vector<sequence> m_alternatives;
+};
+}
+}
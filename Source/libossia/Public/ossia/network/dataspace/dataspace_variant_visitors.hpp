@@ -498,11 +498,11 @@ auto apply(
       {
         case angle_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case angle_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -514,11 +514,11 @@ auto apply(
       {
         case angle_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case angle_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -864,39 +864,39 @@ auto apply(
       {
         case color_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case color_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case color_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         case color_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value3);
         }
         case color_u::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value4);
         }
         case color_u::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value5);
         }
         case color_u::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value6);
         }
         case color_u::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value7);
         }
         case color_u::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value8);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -908,39 +908,39 @@ auto apply(
       {
         case color_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case color_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case color_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         case color_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value3);
         }
         case color_u::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value4);
         }
         case color_u::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value5);
         }
         case color_u::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value6);
         }
         case color_u::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value7);
         }
         case color_u::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value8);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -1370,47 +1370,47 @@ auto apply(
       {
         case distance_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case distance_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case distance_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         case distance_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value3);
         }
         case distance_u::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value4);
         }
         case distance_u::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value5);
         }
         case distance_u::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value6);
         }
         case distance_u::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value7);
         }
         case distance_u::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value8);
         }
         case distance_u::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value9);
         }
         case distance_u::Type::Type10:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value10);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value10);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -1422,47 +1422,47 @@ auto apply(
       {
         case distance_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case distance_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case distance_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         case distance_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value3);
         }
         case distance_u::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value4);
         }
         case distance_u::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value5);
         }
         case distance_u::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value6);
         }
         case distance_u::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value7);
         }
         case distance_u::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value8);
         }
         case distance_u::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value9);
         }
         case distance_u::Type::Type10:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value10);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value10);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -1704,19 +1704,19 @@ auto apply(
       {
         case gain_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case gain_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case gain_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         case gain_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value3);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -1728,19 +1728,19 @@ auto apply(
       {
         case gain_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case gain_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case gain_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         case gain_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value3);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -1927,15 +1927,15 @@ auto apply(
       {
         case orientation_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case orientation_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case orientation_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -1947,15 +1947,15 @@ auto apply(
       {
         case orientation_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case orientation_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case orientation_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -2221,27 +2221,27 @@ auto apply(
       {
         case position_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case position_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case position_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         case position_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value3);
         }
         case position_u::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value4);
         }
         case position_u::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value5);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -2253,27 +2253,27 @@ auto apply(
       {
         case position_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case position_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case position_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         case position_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value3);
         }
         case position_u::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value4);
         }
         case position_u::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value5);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -2551,27 +2551,27 @@ auto apply(
       {
         case speed_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case speed_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case speed_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         case speed_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value3);
         }
         case speed_u::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value4);
         }
         case speed_u::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value5);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -2583,27 +2583,27 @@ auto apply(
       {
         case speed_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case speed_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case speed_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         case speed_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value3);
         }
         case speed_u::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value4);
         }
         case speed_u::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value5);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -2965,39 +2965,39 @@ auto apply(
       {
         case timing_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case timing_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case timing_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         case timing_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value3);
         }
         case timing_u::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value4);
         }
         case timing_u::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value5);
         }
         case timing_u::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value6);
         }
         case timing_u::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value7);
         }
         case timing_u::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value8);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -3009,39 +3009,39 @@ auto apply(
       {
         case timing_u::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case timing_u::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case timing_u::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         case timing_u::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value3);
         }
         case timing_u::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value4);
         }
         case timing_u::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value5);
         }
         case timing_u::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value6);
         }
         case timing_u::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value7);
         }
         case timing_u::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value8);
         }
         default:
           throw std::runtime_error(": bad type");
@@ -5144,11 +5144,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5192,11 +5192,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5250,11 +5250,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5298,11 +5298,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5346,11 +5346,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5394,11 +5394,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5442,11 +5442,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5490,11 +5490,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5538,11 +5538,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5586,11 +5586,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value7, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value7, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5634,11 +5634,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value8, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value8, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5692,11 +5692,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5740,11 +5740,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5788,11 +5788,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5836,11 +5836,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5884,11 +5884,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5932,11 +5932,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -5980,11 +5980,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6028,11 +6028,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value7, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value7, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6076,11 +6076,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value8, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value8, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6124,11 +6124,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6172,11 +6172,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value10, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value10, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value10, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value10, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6229,11 +6229,11 @@ auto apply(Functor&& functor, const gain& arg0, const value_variant_type& arg1)
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6277,11 +6277,11 @@ auto apply(Functor&& functor, const gain& arg0, const value_variant_type& arg1)
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6325,11 +6325,11 @@ auto apply(Functor&& functor, const gain& arg0, const value_variant_type& arg1)
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6373,11 +6373,11 @@ auto apply(Functor&& functor, const gain& arg0, const value_variant_type& arg1)
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6431,11 +6431,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6479,11 +6479,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6527,11 +6527,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6585,11 +6585,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6633,11 +6633,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6681,11 +6681,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6729,11 +6729,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6777,11 +6777,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6825,11 +6825,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6883,11 +6883,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6931,11 +6931,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -6979,11 +6979,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7027,11 +7027,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7075,11 +7075,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7123,11 +7123,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7181,11 +7181,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7229,11 +7229,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7277,11 +7277,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7325,11 +7325,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7373,11 +7373,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7421,11 +7421,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7469,11 +7469,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7517,11 +7517,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value7, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value7, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -7565,11 +7565,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value8, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value8, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
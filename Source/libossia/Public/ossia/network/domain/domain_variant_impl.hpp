@@ -1296,11 +1296,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1344,11 +1344,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1392,11 +1392,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1440,11 +1440,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1488,11 +1488,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1536,11 +1536,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1584,11 +1584,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1632,11 +1632,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value7, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value7, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1680,11 +1680,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value8, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value8, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1728,11 +1728,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1776,11 +1776,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value10, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value10, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value10, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value10, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -2171,47 +2171,47 @@ auto apply(
       {
         case domain_base_variant::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case domain_base_variant::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case domain_base_variant::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         case domain_base_variant::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value3);
         }
         case domain_base_variant::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value4);
         }
         case domain_base_variant::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value5);
         }
         case domain_base_variant::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value6);
         }
         case domain_base_variant::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value7);
         }
         case domain_base_variant::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value8);
         }
         case domain_base_variant::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value9);
         }
         case domain_base_variant::Type::Type10:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value10);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value10);
         }
         default:
           throw std::runtime_error("domain_variant_impl: bad type");
@@ -2223,47 +2223,47 @@ auto apply(
       {
         case domain_base_variant::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case domain_base_variant::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case domain_base_variant::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         case domain_base_variant::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value3);
         }
         case domain_base_variant::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value4);
         }
         case domain_base_variant::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value5);
         }
         case domain_base_variant::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value6);
         }
         case domain_base_variant::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value7);
         }
         case domain_base_variant::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value8);
         }
         case domain_base_variant::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value9);
         }
         case domain_base_variant::Type::Type10:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value10);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value10);
         }
         default:
           throw std::runtime_error("domain_variant_impl: bad type");
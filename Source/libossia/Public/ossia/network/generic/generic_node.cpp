@@ -65,6 +65,9 @@ node_base& generic_node_base::set_name(std::string name)
   }
   on_address_change();
 
+  if (m_parent)
+    m_parent->on_child_renamed(*this, old_name);
+
   // notify observers
   m_device.on_node_renamed(*this, old_name);
 
@@ -103,7 +106,8 @@ void generic_node::set_parameter(
   if (addr)
   {
     m_parameter = std::move(addr);
-    m_device.on_parameter_created(*m_parameter);
+    if (!m_device.in_learned_batch())
+      m_device.on_parameter_created(*m_parameter);
   }
 }
 
@@ -117,7 +121,8 @@ generic_node::create_parameter(ossia::val_type type)
     m_parameter->set_value_type(type);
 
     // notify observers
-    m_device.on_parameter_created(*m_parameter);
+    if (!m_device.in_learned_batch())
+      m_device.on_parameter_created(*m_parameter);
   }
   else
   {
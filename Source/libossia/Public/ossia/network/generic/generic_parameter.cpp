@@ -23,6 +23,7 @@ generic_parameter::generic_parameter(ossia::net::node_base& node)
     , m_boundingMode(ossia::bounding_mode::FREE)
     , m_value(ossia::impulse{})
 {
+  publish_value();
 }
 
 generic_parameter::generic_parameter(
@@ -36,6 +37,8 @@ generic_parameter::generic_parameter(
 {
   m_repetitionFilter
       = get_value_or(data.rep_filter, ossia::repetition_filter::OFF);
+  m_deadband = data.deadband;
+  publish_value();
   update_parameter_type(data.type, *this);
 }
 
@@ -64,6 +67,9 @@ generic_parameter::push_value(const ossia::value& value)
 {
   set_value(value);
 
+  if (m_deadband && in_deadband())
+    return *this;
+
   m_protocol.push(*this, m_value);
 
   return *this;
@@ -74,6 +80,9 @@ generic_parameter::push_value(ossia::value&& value)
 {
   set_value(std::move(value));
 
+  if (m_deadband && in_deadband())
+    return *this;
+
   m_protocol.push(*this, m_value);
 
   return *this;
@@ -81,6 +90,9 @@ generic_parameter::push_value(ossia::value&& value)
 
 ossia::net::generic_parameter& generic_parameter::push_value()
 {
+  if (m_deadband && in_deadband())
+    return *this;
+
   m_protocol.push(*this, m_value);
 
   return *this;
@@ -93,8 +105,35 @@ const ossia::value& generic_parameter::getValue() const
 
 ossia::value generic_parameter::value() const
 {
-  lock_t lock(m_valueMutex);
+  const fixed_value v = m_fixedValue.load();
+  auto get = [&v](auto t) -> ossia::value {
+    std::memcpy(&t, v.data.data(), sizeof(t));
+    return t;
+  };
+
+  switch (v.type)
+  {
+    case ossia::val_type::FLOAT:
+      return get(float{});
+    case ossia::val_type::INT:
+      return get(int32_t{});
+    case ossia::val_type::VEC2F:
+      return get(ossia::vec2f{});
+    case ossia::val_type::VEC3F:
+      return get(ossia::vec3f{});
+    case ossia::val_type::VEC4F:
+      return get(ossia::vec4f{});
+    case ossia::val_type::IMPULSE:
+      return ossia::impulse{};
+    case ossia::val_type::BOOL:
+      return get(bool{});
+    case ossia::val_type::CHAR:
+      return get(char{});
+    default:
+      break;
+  }
 
+  lock_t lock(m_valueMutex);
   return m_value;
 }
 
@@ -119,9 +158,10 @@ generic_parameter::set_value(const ossia::value& val)
       m_value = ossia::convert(val, m_previousValue);
       copy = m_value;
     }
+    publish_value();
   }
 
-  send(copy);
+  notify(copy);
   return *this;
 }
 
@@ -146,9 +186,10 @@ ossia::net::generic_parameter& generic_parameter::set_value(ossia::value&& val)
       m_value = ossia::convert(std::move(val), m_previousValue);
       copy = m_value;
     }
+    publish_value();
   }
 
-  send(copy);
+  notify(copy);
   return *this;
 }
 
@@ -169,6 +210,7 @@ void generic_parameter::set_value_quiet(const ossia::value& val)
     m_previousValue = std::move(m_value);
     m_value = ossia::convert(val, m_previousValue);
   }
+  publish_value();
 }
 
 void generic_parameter::set_value_quiet(ossia::value&& val)
@@ -188,6 +230,7 @@ void generic_parameter::set_value_quiet(ossia::value&& val)
     m_previousValue = std::move(m_value);
     m_value = ossia::convert(std::move(val), m_previousValue);
   }
+  publish_value();
 }
 
 void generic_parameter::set_value_quiet(const destination& destination)
@@ -197,6 +240,7 @@ void generic_parameter::set_value_quiet(const destination& destination)
   {
     m_previousValue = std::move(m_value); // TODO also implement me for MIDI
     m_value = destination.address().fetch_value();
+    publish_value();
   }
   else
   {
@@ -223,6 +267,7 @@ generic_parameter::set_value_type(ossia::val_type type)
     m_valueType = type;
 
     m_value = init_value(type);
+    publish_value();
     if (m_domain)
     {
       convert_compatible_domain(m_domain, m_valueType);
@@ -289,6 +334,57 @@ bool generic_parameter::filter_value(const ossia::value& val) const
              && val == m_previousValue);
 }
 
+void generic_parameter::publish_value() noexcept
+{
+  fixed_value v{};
+  auto set = [&v](const auto& t) {
+    std::memcpy(v.data.data(), &t, sizeof(t));
+  };
+
+  switch (v.type = m_value.get_type())
+  {
+    case ossia::val_type::FLOAT:
+      set(m_value.get<float>());
+      break;
+    case ossia::val_type::INT:
+      set(m_value.get<int32_t>());
+      break;
+    case ossia::val_type::VEC2F:
+      set(m_value.get<ossia::vec2f>());
+      break;
+    case ossia::val_type::VEC3F:
+      set(m_value.get<ossia::vec3f>());
+      break;
+    case ossia::val_type::VEC4F:
+      set(m_value.get<ossia::vec4f>());
+      break;
+    case ossia::val_type::IMPULSE:
+      break;
+    case ossia::val_type::BOOL:
+      set(m_value.get<bool>());
+      break;
+    case ossia::val_type::CHAR:
+      set(m_value.get<char>());
+      break;
+    default:
+      v.type = ossia::val_type::NONE;
+      break;
+  }
+
+  m_fixedValue.store(v);
+}
+
+bool generic_parameter::in_deadband()
+{
+  lock_t lock(m_valueMutex);
+  if (m_lastSentValue.valid()
+      && !outside_deadband(*m_deadband, m_lastSentValue, m_value))
+    return true;
+
+  m_lastSentValue = m_value;
+  return false;
+}
+
 void generic_parameter::on_first_callback_added()
 {
   m_protocol.observe(*this, true);
@@ -313,6 +409,7 @@ generic_parameter& generic_parameter::set_unit(const unit_t& v)
       {
         m_valueType = vt;
         m_value = ossia::convert(m_value, m_valueType);
+        publish_value();
         if (m_domain)
         {
           convert_compatible_domain(m_domain, m_valueType);
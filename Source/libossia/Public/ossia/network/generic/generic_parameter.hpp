@@ -2,12 +2,17 @@
 #include <ossia/detail/callback_container.hpp>
 #include <ossia/detail/mutex.hpp>
 #include <ossia/detail/optional.hpp>
+#include <ossia/detail/seqlock.hpp>
 #include <ossia/network/base/node_attributes.hpp>
 #include <ossia/network/base/parameter.hpp>
 #include <ossia/network/domain/domain.hpp>
 #include <ossia/network/generic/generic_device.hpp>
 #include <ossia/network/value/value.hpp>
+#include <ossia/network/value/value_conversion.hpp>
+#include <ossia/network/value/value_traits.hpp>
 
+#include <array>
+#include <cstring>
 #include <string>
 #include <thread>
 #include <vector>
@@ -21,10 +26,21 @@ struct parameter_data;
 class protocol_base;
 
 //! Default implementation for parameter_base, with everything expected and
-//! mutable
+//! mutable.
+//!
+//! Values of a fixed size (numbers, vectors, bools, chars and impulses)
+//! are also stored in a seqlock : value() and value_as() read them without
+//! locking, hence without blocking the threads which set them.
 class OSSIA_EXPORT generic_parameter : public ossia::net::parameter_base
 {
 protected:
+  //! Copy of m_value if it has a fixed size, else type is NONE
+  struct fixed_value
+  {
+    std::array<float, 4> data;
+    ossia::val_type type{ossia::val_type::NONE};
+  };
+
   ossia::net::protocol_base& m_protocol;
 
   ossia::val_type m_valueType{};
@@ -33,10 +49,12 @@ protected:
 
   mutable mutex_t m_valueMutex;
   ossia::value m_value;
+  ossia::seqlock<fixed_value> m_fixedValue;
 
   ossia::domain m_domain;
 
   ossia::value m_previousValue; //! Used for repetition filter.
+  ossia::value m_lastSentValue; //! Used for the deadband.
 public:
   generic_parameter(ossia::net::node_base& node_base);
   generic_parameter(const parameter_data&, ossia::net::node_base& node_base);
@@ -54,6 +72,25 @@ public:
 
   const ossia::value& getValue() const;
   ossia::value value() const final override;
+
+  //! The current value converted to T.
+  //! Does not lock nor build a value if the value has already type T.
+  template <typename T>
+  T value_as() const
+  {
+    if constexpr (std::is_trivially_copyable<T>::value && sizeof(T) <= sizeof(fixed_value::data))
+    {
+      const fixed_value v = m_fixedValue.load();
+      if (v.type == ossia::value_trait<T>::ossia_enum)
+      {
+        T res;
+        std::memcpy(&res, v.data.data(), sizeof(T));
+        return res;
+      }
+    }
+    return ossia::convert<T>(value());
+  }
+
   generic_parameter& set_value(const ossia::value&) override;
   generic_parameter& set_value(ossia::value&&) override;
 
@@ -85,6 +122,9 @@ public:
   void on_removing_last_callback() final override;
 
 private:
+  bool in_deadband();
+  void publish_value() noexcept;
+
   friend struct update_parameter_visitor;
 };
 }
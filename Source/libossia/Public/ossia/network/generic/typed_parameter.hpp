@@ -0,0 +1,467 @@
+#pragma once
+#include <ossia/detail/math.hpp>
+#include <ossia/detail/mutex.hpp>
+#include <ossia/detail/seqlock.hpp>
+#include <ossia/network/base/device.hpp>
+#include <ossia/network/base/node.hpp>
+#include <ossia/network/base/parameter.hpp>
+#include <ossia/network/base/protocol.hpp>
+#include <ossia/network/domain/domain.hpp>
+#include <ossia/network/value/value.hpp>
+#include <ossia/network/value/value_conversion.hpp>
+#include <ossia/network/value/value_traits.hpp>
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace ossia
+{
+namespace net
+{
+
+/**
+ * @brief Parameter whose value type is fixed at compile time
+ *
+ * The value is stored as T instead of ossia::value : setting, reading,
+ * comparing and bounding it does not go through the variant, which is only
+ * built at the boundary of the virtual parameter_base API, e.g. to give the
+ * value to the protocol.
+ *
+ * The domain bounds are converted to T when the domain or the bounding mode
+ * change, and a bounding function specialized for the mode is chosen then.
+ * Domains restricted to a set of values go through ossia::apply_domain.
+ *
+ * T can be float, int32_t, bool, vec2f, vec3f or vec4f. Readers do not lock :
+ * the value is stored in a seqlock.
+ *
+ * set_value_type does nothing since the type cannot change.
+ *
+ * \see create_typed_parameter
+ */
+template <typename T>
+class typed_parameter final : public ossia::net::parameter_base
+{
+  static_assert(
+      std::is_same<T, float>::value || std::is_same<T, int32_t>::value
+          || std::is_same<T, bool>::value
+          || std::is_same<T, ossia::vec2f>::value
+          || std::is_same<T, ossia::vec3f>::value
+          || std::is_same<T, ossia::vec4f>::value,
+      "typed_parameter only supports fixed-size value types");
+
+public:
+  using value_type = T;
+
+  explicit typed_parameter(ossia::net::node_base& node)
+      : parameter_base{node}, m_protocol{node.get_device().get_protocol()}
+  {
+  }
+
+  ~typed_parameter() override
+  {
+    callback_container<value_callback>::callbacks_clear();
+  }
+
+  //! The current value, without locking
+  T typed_value() const noexcept
+  {
+    return m_value.load();
+  }
+
+  typed_parameter& set_value(T v)
+  {
+    changed(store(v));
+    return *this;
+  }
+
+  typed_parameter& push_value(T v)
+  {
+    v = store(v);
+    changed(v);
+    push(v);
+    return *this;
+  }
+
+  void set_value_quiet(T v)
+  {
+    store(v);
+  }
+
+  void pull_value() override
+  {
+    m_protocol.pull(*this);
+  }
+
+  std::future<void> pull_value_async() override
+  {
+    return m_protocol.pull_async(*this);
+  }
+
+  void request_value() override
+  {
+    m_protocol.request(*this);
+  }
+
+  ossia::value value() const override
+  {
+    return m_value.load();
+  }
+
+  typed_parameter& push_value(const ossia::value& v) override
+  {
+    if (v.valid())
+    {
+      const T t = store(v);
+      changed(t);
+      push(t);
+    }
+    return *this;
+  }
+
+  typed_parameter& push_value(ossia::value&& v) override
+  {
+    return push_value(static_cast<const ossia::value&>(v));
+  }
+
+  typed_parameter& push_value() override
+  {
+    push(m_value.load());
+    return *this;
+  }
+
+  typed_parameter& set_value(const ossia::value& v) override
+  {
+    if (v.valid())
+      changed(store(v));
+    return *this;
+  }
+
+  typed_parameter& set_value(ossia::value&& v) override
+  {
+    return set_value(static_cast<const ossia::value&>(v));
+  }
+
+  void set_value_quiet(const ossia::value& v) override
+  {
+    if (v.valid())
+      store(v);
+  }
+
+  void set_value_quiet(ossia::value&& v) override
+  {
+    set_value_quiet(static_cast<const ossia::value&>(v));
+  }
+
+  ossia::val_type get_value_type() const override
+  {
+    return ossia::value_trait<T>::ossia_enum;
+  }
+
+  typed_parameter& set_value_type(ossia::val_type) override
+  {
+    return *this;
+  }
+
+  ossia::access_mode get_access() const override
+  {
+    return m_accessMode;
+  }
+
+  typed_parameter& set_access(ossia::access_mode mode) override
+  {
+    if (m_accessMode != mode)
+    {
+      m_accessMode = mode;
+      m_node.get_device().on_attribute_modified(
+          m_node, std::string(text_access_mode()));
+    }
+    return *this;
+  }
+
+  const ossia::domain& get_domain() const override
+  {
+    return m_domain;
+  }
+
+  typed_parameter& set_domain(const ossia::domain& d) override
+  {
+    if (m_domain != d)
+    {
+      {
+        lock_t lock(m_valueMutex);
+        m_domain = d;
+        update_bounds();
+      }
+      m_node.get_device().on_attribute_modified(
+          m_node, std::string(text_domain()));
+    }
+    return *this;
+  }
+
+  ossia::bounding_mode get_bounding() const override
+  {
+    return m_boundingMode;
+  }
+
+  typed_parameter& set_bounding(ossia::bounding_mode b) override
+  {
+    if (m_boundingMode != b)
+    {
+      {
+        lock_t lock(m_valueMutex);
+        m_boundingMode = b;
+        update_bounds();
+      }
+      m_node.get_device().on_attribute_modified(
+          m_node, std::string(text_bounding_mode()));
+    }
+    return *this;
+  }
+
+  bool filter_value(const ossia::value& v) const override
+  {
+    if (m_disabled || m_muted)
+      return true;
+    if (get_repetition_filter() != ossia::repetition_filter::ON)
+      return false;
+
+    lock_t lock(m_valueMutex);
+    return to_typed(v, m_current) == m_previous;
+  }
+
+  void on_first_callback_added() override
+  {
+    m_protocol.observe(*this, true);
+  }
+
+  void on_removing_last_callback() override
+  {
+    m_protocol.observe(*this, false);
+  }
+
+private:
+  using bound_fun = T (typed_parameter::*)(T) const;
+  static constexpr bool is_vec = !std::is_arithmetic<T>::value;
+  using component_type =
+      typename std::conditional<is_vec, float, T>::type;
+
+  // Bounds v and makes it the current value, returns the bounded value
+  T store(T v)
+  {
+    lock_t lock(m_valueMutex);
+    return store_locked(v);
+  }
+
+  // Same, for a value which may only give some components, e.g. a list
+  // shorter than the vector: the others keep their current value.
+  T store(const ossia::value& v)
+  {
+    lock_t lock(m_valueMutex);
+    return store_locked(to_typed(v, m_current));
+  }
+
+  T store_locked(T v)
+  {
+    m_previous = m_current;
+    m_current = (this->*m_bound)(v);
+    m_value.store(m_current);
+    return m_current;
+  }
+
+  void changed(T v)
+  {
+    if (!callbacks_empty() || m_history)
+      notify(ossia::value{v});
+  }
+
+  void push(T v)
+  {
+    if (m_deadband)
+    {
+      lock_t lock(m_valueMutex);
+      if (m_sent
+          && !outside_deadband(
+              *m_deadband, ossia::value{m_lastSent}, ossia::value{v}))
+        return;
+
+      m_lastSent = v;
+      m_sent = true;
+    }
+
+    m_protocol.push(*this, ossia::value{v});
+  }
+
+  //! Converts v to T, with the components v does not give taken from cur
+  static T to_typed(const ossia::value& v, const T& cur)
+  {
+    if (auto t = v.target<T>())
+      return *t;
+
+    if constexpr (is_vec)
+    {
+      // A shorter list only changes the first components
+      if (auto list = v.target<std::vector<ossia::value>>())
+      {
+        T res = cur;
+        const auto n = std::min(list->size(), res.size());
+        for (std::size_t i = 0; i < n; i++)
+          res[i] = ossia::convert<float>((*list)[i]);
+        return res;
+      }
+    }
+    return ossia::convert<T>(cur, v);
+  }
+
+  // Applies f to each component, with the matching bounds
+  template <typename F>
+  T map_components(T v, F f) const noexcept
+  {
+    if constexpr (is_vec)
+    {
+      for (std::size_t i = 0; i < v.size(); i++)
+        v[i] = f(v[i], m_min[i], m_max[i]);
+      return v;
+    }
+    else
+    {
+      return f(v, m_min, m_max);
+    }
+  }
+
+  T bound_free(T v) const noexcept
+  {
+    return v;
+  }
+
+  T bound_clip(T v) const noexcept
+  {
+    return map_components(
+        v, [](auto x, auto min, auto max) { return ossia::clamp(x, min, max); });
+  }
+
+  T bound_low(T v) const noexcept
+  {
+    return map_components(
+        v, [](auto x, auto min, auto) { return ossia::clamp_min(x, min); });
+  }
+
+  T bound_high(T v) const noexcept
+  {
+    return map_components(
+        v, [](auto x, auto, auto max) { return ossia::clamp_max(x, max); });
+  }
+
+  T bound_wrap(T v) const noexcept
+  {
+    return map_components(v, [](auto x, auto min, auto max) {
+      return decltype(x)(ossia::wrap(x, min, max));
+    });
+  }
+
+  T bound_fold(T v) const noexcept
+  {
+    return map_components(v, [](auto x, auto min, auto max) {
+      return decltype(x)(ossia::fold(x, min, max));
+    });
+  }
+
+  T bound_values(T v) const
+  {
+    return to_typed(
+        ossia::apply_domain(m_domain, m_boundingMode, ossia::value{v}), v);
+  }
+
+  // Called with m_valueMutex locked
+  void update_bounds()
+  {
+    m_bound = &typed_parameter::bound_free;
+    if constexpr (!std::is_same<T, bool>::value)
+    {
+      if (!m_domain || m_boundingMode == ossia::bounding_mode::FREE)
+        return;
+
+      if (!ossia::get_values(m_domain).empty())
+      {
+        m_bound = &typed_parameter::bound_values;
+        return;
+      }
+
+      const auto min = ossia::get_min(m_domain);
+      const auto max = ossia::get_max(m_domain);
+      const auto lowest = splat(std::numeric_limits<component_type>::lowest());
+      const auto highest = splat(std::numeric_limits<component_type>::max());
+      m_min = min.valid() ? to_typed(min, lowest) : lowest;
+      m_max = max.valid() ? to_typed(max, highest) : highest;
+
+      switch (m_boundingMode)
+      {
+        case ossia::bounding_mode::CLIP:
+          m_bound = &typed_parameter::bound_clip;
+          break;
+        case ossia::bounding_mode::LOW:
+          m_bound = &typed_parameter::bound_low;
+          break;
+        case ossia::bounding_mode::HIGH:
+          m_bound = &typed_parameter::bound_high;
+          break;
+        case ossia::bounding_mode::WRAP:
+          if (min.valid() && max.valid())
+            m_bound = &typed_parameter::bound_wrap;
+          break;
+        case ossia::bounding_mode::FOLD:
+          if (min.valid() && max.valid())
+            m_bound = &typed_parameter::bound_fold;
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  static T splat(component_type c) noexcept
+  {
+    if constexpr (is_vec)
+    {
+      T v;
+      v.fill(c);
+      return v;
+    }
+    else
+    {
+      return c;
+    }
+  }
+
+  ossia::net::protocol_base& m_protocol;
+
+  ossia::access_mode m_accessMode{ossia::access_mode::BI};
+  ossia::bounding_mode m_boundingMode{ossia::bounding_mode::FREE};
+  ossia::domain m_domain;
+
+  // Guards the members below and serializes the writes of m_value
+  mutable ossia::mutex_t m_valueMutex;
+  ossia::seqlock<T> m_value{T{}};
+  T m_current{};
+  T m_previous{}; //! Used for the repetition filter.
+  T m_lastSent{}; //! Used for the deadband.
+  bool m_sent{};
+
+  bound_fun m_bound{&typed_parameter::bound_free};
+  T m_min{};
+  T m_max{};
+};
+
+//! Creates a typed_parameter<T> on a node, replacing its current parameter
+template <typename T>
+typed_parameter<T>* create_typed_parameter(ossia::net::node_base& node)
+{
+  auto param = std::make_unique<typed_parameter<T>>(node);
+  auto ptr = param.get();
+  node.set_parameter(std::move(param));
+  return node.get_parameter() == ptr ? ptr : nullptr;
+}
+}
+}
@@ -1,19 +1,185 @@
 // This is an open source non-commercial project. Dear PVS-Studio, please check
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <ossia/detail/hash_map.hpp>
+#include <ossia/network/base/encoded_message.hpp>
 #include <ossia/network/generic/generic_device.hpp>
 #include <ossia/network/generic/generic_parameter.hpp>
 #include <ossia/network/local/local.hpp>
 
+#include <condition_variable>
+#include <thread>
+
 namespace ossia
 {
 namespace net
 {
+struct multiplex_protocol::outbound_queue
+{
+  struct entry
+  {
+    const ossia::net::parameter_base* parameter{};
+    ossia::value value;
+  };
+
+  outbound_queue(protocol_base& p, std::size_t sz)
+      : protocol{p}, capacity{std::max<std::size_t>(sz, 1)}
+  {
+    queue.reserve(capacity);
+    batch.reserve(capacity);
+    thread = std::thread{[this] { run(); }};
+  }
+
+  ~outbound_queue()
+  {
+    {
+      std::lock_guard lock{mutex};
+      running = false;
+    }
+    wakeup.notify_one();
+    thread.join();
+  }
+
+  void push(const parameter_base& p, const ossia::value& v)
+  {
+    {
+      std::lock_guard lock{mutex};
+      if (latest.empty() && queue.size() < capacity)
+      {
+        queue.push_back({&p, v});
+        if (queue.size() > 1)
+          return;
+      }
+      else
+      {
+        coalesce(p, v);
+        return;
+      }
+    }
+    wakeup.notify_one();
+  }
+
+  // Once the queue has been full, and until the thread takes its content,
+  // it holds a single value per parameter: values are dropped only when
+  // it is full of distinct parameters.
+  void coalesce(const parameter_base& p, const ossia::value& v)
+  {
+    if (latest.empty())
+      compact();
+
+    auto it = latest.find(&p);
+    if (it != latest.end())
+    {
+      queue[it->second].value = v;
+      coalesced++;
+    }
+    else if (queue.size() < capacity)
+    {
+      latest.emplace(&p, queue.size());
+      queue.push_back({&p, v});
+    }
+    else
+    {
+      dropped++;
+    }
+  }
+
+  // Keeps the last value of each parameter, at the place of its first one
+  void compact()
+  {
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < queue.size(); i++)
+    {
+      auto& e = queue[i];
+      if (!e.parameter)
+        continue;
+
+      auto res = latest.emplace(e.parameter, n);
+      if (res.second)
+      {
+        if (i != n)
+          queue[n] = std::move(e);
+        n++;
+      }
+      else
+      {
+        queue[res.first->second].value = std::move(e.value);
+        coalesced++;
+      }
+    }
+    queue.resize(n);
+  }
+
+  void run()
+  {
+    while (true)
+    {
+      {
+        std::unique_lock lock{mutex};
+        wakeup.wait(lock, [this] { return !queue.empty() || !running; });
+        if (queue.empty())
+          return;
+
+        std::swap(queue, batch);
+        latest.clear();
+      }
+
+      {
+        std::lock_guard lock{send_mutex};
+        for (auto& e : batch)
+          if (e.parameter)
+            protocol.push(*e.parameter, e.value);
+        batch.clear();
+      }
+    }
+  }
+
+  void remove(const parameter_base& p)
+  {
+    // Waits for the values being sent
+    std::lock_guard send_lock{send_mutex};
+    std::lock_guard lock{mutex};
+    for (auto* entries : {&queue, &batch})
+      for (auto& e : *entries)
+        if (e.parameter == &p)
+          e.parameter = nullptr;
+    latest.erase(&p);
+  }
+
+  queue_stats stats() const
+  {
+    std::lock_guard lock{mutex};
+    return {queue.size(), coalesced, dropped};
+  }
+
+  protocol_base& protocol;
+  const std::size_t capacity{};
+
+  mutable std::mutex mutex;
+  std::condition_variable wakeup;
+  std::vector<entry> queue;
+  ossia::fast_hash_map<const ossia::net::parameter_base*, std::size_t> latest;
+  uint64_t coalesced{};
+  uint64_t dropped{};
+  bool running{true};
+
+  // Held by the thread while it sends a batch
+  std::mutex send_mutex;
+  std::vector<entry> batch;
+
+  std::thread thread;
+};
+
 multiplex_protocol::multiplex_protocol()
 {
 }
 
 multiplex_protocol::~multiplex_protocol()
 {
+  m_queues.clear();
+
+  if (m_device)
+    m_device->on_parameter_removing
+        .disconnect<&multiplex_protocol::parameter_removed>(this);
 }
 
 bool multiplex_protocol::pull(ossia::net::parameter_base& address)
@@ -23,9 +189,21 @@ bool multiplex_protocol::pull(ossia::net::parameter_base& address)
 
 bool multiplex_protocol::push(const ossia::net::parameter_base& address, const ossia::value& v)
 {
+  if (m_async)
+  {
+    for (auto& queue : m_queues)
+      queue->push(address, v);
+    return true;
+  }
+
+  if (m_protocols.size() == 1)
+    return m_protocols.front()->push(address, v);
+
+  // The protocols share the filtered value and its encodings
+  encoded_message msg{address, v};
   bool b = true;
   for (auto& proto : m_protocols)
-    b &= proto->push(address, v);
+    b &= proto->push_encoded(msg);
 
   return b;
 }
@@ -62,7 +240,19 @@ void multiplex_protocol::stop()
 
 void multiplex_protocol::set_device(device_base& dev)
 {
+  if (m_device)
+    m_device->on_parameter_removing
+        .disconnect<&multiplex_protocol::parameter_removed>(this);
+
   m_device = &dev;
+  m_device->on_parameter_removing
+      .connect<&multiplex_protocol::parameter_removed>(this);
+}
+
+void multiplex_protocol::parameter_removed(const parameter_base& p)
+{
+  for (auto& queue : m_queues)
+    queue->remove(p);
 }
 
 static void observe_rec(protocol_base& proto, ossia::net::node_base& n)
@@ -89,21 +279,52 @@ void multiplex_protocol::expose_to(std::unique_ptr<protocol_base> p)
     // Expose all the adresses with callbacks
     observe_rec(*p, m_device->get_root_node());
 
+    if (m_async)
+      m_queues.push_back(std::make_unique<outbound_queue>(*p, m_queueSize));
     m_protocols.push_back(std::move(p));
   }
 }
 
 void multiplex_protocol::stop_expose_to(const protocol_base& p)
 {
-  m_protocols.erase(
-      ossia::remove_if(
-          m_protocols, [&](const auto& ptr) { return ptr.get() == &p; }),
-      m_protocols.end());
+  auto it = ossia::find_if(
+      m_protocols, [&](const auto& ptr) { return ptr.get() == &p; });
+  if (it == m_protocols.end())
+    return;
+
+  // The queue still uses the protocol
+  if (m_async)
+    m_queues.erase(m_queues.begin() + (it - m_protocols.begin()));
+  m_protocols.erase(it);
 }
 
 void ossia::net::multiplex_protocol::clear()
 {
+  m_queues.clear();
   m_protocols.clear();
 }
+
+void multiplex_protocol::set_async(bool async, std::size_t queue_size)
+{
+  // Sends what is still queued
+  m_queues.clear();
+
+  m_async = async;
+  m_queueSize = queue_size;
+  if (m_async)
+  {
+    for (auto& proto : m_protocols)
+      m_queues.push_back(std::make_unique<outbound_queue>(*proto, m_queueSize));
+  }
+}
+
+multiplex_protocol::queue_stats
+multiplex_protocol::get_queue_stats(const protocol_base& p) const
+{
+  for (std::size_t i = 0; i < m_queues.size(); i++)
+    if (m_protocols[i].get() == &p)
+      return m_queues[i]->stats();
+  return {};
+}
 }
 }
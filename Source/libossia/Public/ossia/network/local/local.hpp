@@ -3,6 +3,8 @@
 #include <ossia/detail/algorithms.hpp>
 #include <ossia/network/base/protocol.hpp>
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace ossia
@@ -17,6 +19,13 @@ class generic_device;
  * For instance use this when developing an artistic application with
  * parameters
  * that you want to be able to control from another software.
+ *
+ * Values are pushed to the protocols with push_encoded: protocols sending
+ * the same encoding, e.g. several OSC destinations, encode each value once.
+ *
+ * In asynchronous mode, each protocol instead gets a bounded queue of
+ * values and a thread which pushes them, so that a slow protocol does not
+ * block the caller nor the other protocols.
  */
 class OSSIA_EXPORT multiplex_protocol final : public ossia::net::protocol_base
 {
@@ -60,6 +69,35 @@ public:
 
   void clear();
 
+  /**
+   * @brief Pushes the values to each protocol from its own thread
+   *
+   * When the queue of a protocol is full, it is compacted to the last value
+   * of each parameter, and until it is sent a new value replaces the one
+   * queued for the same parameter. A value is only dropped when the queue
+   * is full of distinct parameters.
+   *
+   * Disabling the asynchronous mode waits until the queued values are sent.
+   */
+  void set_async(bool async, std::size_t queue_size = 4096);
+  bool async() const noexcept
+  {
+    return m_async;
+  }
+
+  struct queue_stats
+  {
+    //! Values waiting to be sent
+    std::size_t depth{};
+    //! Values replaced by a newer one for the same parameter
+    uint64_t coalesced{};
+    //! Values dropped because the queue was full of distinct parameters
+    uint64_t dropped{};
+  };
+
+  //! Statistics of the queue of a protocol, empty if not asynchronous.
+  queue_stats get_queue_stats(const ossia::net::protocol_base& p) const;
+
   //! The protocols we are currently exposing this device through.
   const auto& get_protocols() const
   {
@@ -67,7 +105,17 @@ public:
   }
 
 private:
+  struct outbound_queue;
+
+  void parameter_removed(const ossia::net::parameter_base& p);
+
   std::vector<std::unique_ptr<ossia::net::protocol_base>> m_protocols;
+
+  // Same indices as m_protocols, when asynchronous
+  std::vector<std::unique_ptr<outbound_queue>> m_queues;
+  std::size_t m_queueSize{4096};
+  bool m_async{};
+
   ossia::net::device_base* m_device{};
 };
 
@@ -7,3 +7,5 @@
 #include <ossia/network/local/local.hpp>
 #include <ossia/network/minuit/minuit.hpp>
 #include <ossia/network/osc/osc.hpp>
+#include <ossia/network/osc/osc_tcp.hpp>
+#include <ossia/network/shm/shm_protocol.hpp>
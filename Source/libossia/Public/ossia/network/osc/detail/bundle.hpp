@@ -0,0 +1,263 @@
+#pragma once
+#include <ossia/detail/logger.hpp>
+#include <ossia/detail/string_view.hpp>
+#include <ossia/network/base/parameter.hpp>
+#include <ossia/network/base/parameter_data.hpp>
+#include <ossia/network/common/network_logger.hpp>
+#include <ossia/network/osc/detail/message_generator.hpp>
+#include <ossia/network/osc/detail/osc.hpp>
+#include <ossia/network/osc/detail/osc_fwd.hpp>
+#include <ossia/network/value/format_value.hpp>
+#include <ossia/network/value/value.hpp>
+
+#include <oscpack/osc/OscOutboundPacketStream.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace ossia
+{
+namespace net
+{
+/**
+ * @brief Encodes messages into OSC bundles that fit a payload budget
+ *
+ * Messages are appended to the current bundle until the next one would
+ * make it larger than the maximum size: the bundle is then handed to the
+ * send function and a new one is started.
+ * A message which is too large to fit in any bundle is sent in a bundle
+ * of its own.
+ *
+ * The buffers are kept between uses, so that encoding bundles every frame
+ * does not allocate once they have grown to the working size.
+ *
+ * Usage:
+ * \code
+ * enc.begin();
+ * for(...)
+ *   enc.add(address, value, send);
+ * enc.end(send);
+ * \endcode
+ * with send a callable taking (const char* data, std::size_t size).
+ */
+class bundle_encoder
+{
+public:
+  //! Largest UDP payload which does not get fragmented on an Ethernet link
+  static constexpr std::size_t default_max_size = 1500 - 20 - 8;
+
+  explicit bundle_encoder(std::size_t max_size = default_max_size)
+  {
+    set_max_size(max_size);
+  }
+
+  std::size_t max_size() const noexcept
+  {
+    return m_maxSize;
+  }
+
+  void set_max_size(std::size_t sz)
+  {
+    m_maxSize = std::max(sz, header_size + 32);
+    m_bundle.reserve(m_maxSize);
+  }
+
+  //! Starts a new sequence of bundles.
+  void begin()
+  {
+    reset_bundle();
+  }
+
+  /**
+   * @brief Appends a message to the current bundle
+   *
+   * @return false if the message could not be encoded.
+   */
+  template <typename SendFun>
+  bool add(ossia::string_view address, const ossia::value& val, SendFun& send)
+  {
+    std::size_t msg_size = encode_message(address, val);
+    if (msg_size == 0)
+      return false;
+
+    const std::size_t element_size = 4 + msg_size;
+    if (m_bundle.size() + element_size > m_maxSize
+        && m_bundle.size() > header_size)
+    {
+      send(m_bundle.data(), m_bundle.size());
+      reset_bundle();
+    }
+
+    const std::size_t pos = m_bundle.size();
+    m_bundle.resize(pos + element_size);
+    write_int32(m_bundle.data() + pos, uint32_t(msg_size));
+    std::memcpy(m_bundle.data() + pos + 4, m_message.data(), msg_size);
+    return true;
+  }
+
+  //! Sends the last bundle if it is not empty.
+  template <typename SendFun>
+  void end(SendFun& send)
+  {
+    if (m_bundle.size() > header_size)
+      send(m_bundle.data(), m_bundle.size());
+    reset_bundle();
+  }
+
+private:
+  // "#bundle\0" followed by the 64-bit time tag
+  static constexpr std::size_t header_size = 16;
+
+  // Messages larger than this are dropped, as in
+  // oscpack::DynamicMessageGenerator
+  static constexpr std::size_t max_message_size = 1024 * 1024;
+
+  static void write_int32(char* p, uint32_t v) noexcept
+  {
+    p[0] = char((v >> 24) & 0xFF);
+    p[1] = char((v >> 16) & 0xFF);
+    p[2] = char((v >> 8) & 0xFF);
+    p[3] = char(v & 0xFF);
+  }
+
+  void reset_bundle()
+  {
+    m_bundle.resize(header_size);
+    std::memcpy(m_bundle.data(), "#bundle\0", 8);
+
+    // Immediate time tag
+    write_int32(m_bundle.data() + 8, 0);
+    write_int32(m_bundle.data() + 12, 1);
+  }
+
+  std::size_t encode_message(ossia::string_view address, const ossia::value& val)
+  {
+    if (m_message.empty())
+      m_message.resize(2048);
+
+    for (;;)
+    {
+      try
+      {
+        oscpack::OutboundPacketStream str(m_message.data(), m_message.size());
+        str << oscpack::BeginMessageN(address);
+        val.apply(osc_outbound_visitor{{str}});
+        str << oscpack::EndMessage();
+        return str.Size();
+      }
+      catch (const oscpack::OutOfBufferMemoryException&)
+      {
+        if (m_message.size() >= max_message_size)
+          return 0;
+        m_message.resize(m_message.size() * 2);
+      }
+    }
+  }
+
+  std::vector<char> m_bundle;
+  std::vector<char> m_message;
+  std::size_t m_maxSize{};
+};
+
+namespace detail
+{
+template <typename SendFun>
+struct bundle_writer
+{
+  bundle_encoder& encoder;
+  SendFun& send;
+  bool ok{true};
+
+  void operator()(const char* data, std::size_t sz)
+  {
+    ok &= bool(send(data, sz));
+  }
+
+  template <typename Addr_T>
+  void add(
+      const Addr_T& addr, ossia::string_view address, const ossia::value& v)
+  {
+    if (addr.get_access() == ossia::access_mode::GET)
+      return;
+
+    ossia::value val = filter_value(addr, v);
+    if (val.valid())
+      ok &= encoder.add(address, val, *this);
+  }
+
+  bool end()
+  {
+    encoder.end(*this);
+    return ok;
+  }
+};
+}
+
+/**
+ * The push_bundle, push_bundle_values, push_raw_bundle and push_encoded
+ * implementations shared by the protocols which send OSC packets.
+ *
+ * send(data, size) gives a packet to the transport and returns false if it
+ * was dropped. The caller serializes the uses of the encoder.
+ */
+template <typename SendFun>
+bool write_bundle(
+    bundle_encoder& enc, const std::vector<const parameter_base*>& addresses,
+    SendFun send)
+{
+  detail::bundle_writer<SendFun> w{enc, send};
+  enc.begin();
+  for (auto a : addresses)
+    w.add(*a, a->get_node().osc_address(), a->value());
+  return w.end();
+}
+
+template <typename SendFun>
+bool write_bundle_values(
+    bundle_encoder& enc,
+    const std::vector<std::pair<const parameter_base*, ossia::value>>& values,
+    SendFun send)
+{
+  detail::bundle_writer<SendFun> w{enc, send};
+  enc.begin();
+  for (const auto& [a, v] : values)
+    w.add(*a, a->get_node().osc_address(), v);
+  return w.end();
+}
+
+template <typename SendFun>
+bool write_raw_bundle(
+    bundle_encoder& enc,
+    const std::vector<ossia::net::full_parameter_data>& addresses,
+    SendFun send)
+{
+  detail::bundle_writer<SendFun> w{enc, send};
+  enc.begin();
+  for (const auto& addr : addresses)
+    w.add(addr, addr.address, addr.value());
+  return w.end();
+}
+
+//! Sends the OSC packet of a message, encoded once for all the protocols
+template <typename SendFun>
+bool write_encoded(
+    encoded_message& msg, const network_logger& logger, SendFun send)
+{
+  if (msg.parameter.get_access() == ossia::access_mode::GET)
+    return false;
+
+  auto packet = osc_packet(msg);
+  if (packet.empty())
+    return false;
+
+  const bool ok = send(packet.data(), packet.size());
+  if (logger.outbound_logger && !logger.packet_log)
+    logger.outbound_logger->info(
+        "Out: {} {}", msg.parameter.get_node().osc_address(), msg.filtered());
+  return ok;
+}
+}
+}
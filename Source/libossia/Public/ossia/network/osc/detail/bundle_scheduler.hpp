@@ -0,0 +1,178 @@
+#pragma once
+#include <ossia/detail/logger.hpp>
+#include <ossia/detail/timer_wheel.hpp>
+#include <ossia/network/osc/osc.hpp>
+
+#include <oscpack/ip/IpEndpointName.h>
+#include <oscpack/ip/TimerListener.h>
+#include <oscpack/osc/OscReceivedElements.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace ossia
+{
+namespace net
+{
+/**
+ * @brief Holds the bundles dated in the future until their time tag
+ *
+ * schedule() and TimerExpired() are meant to be called from the thread
+ * receiving the messages : the scheduler is attached as a periodic timer of
+ * the receive socket, so that there is a single thread for all the pending
+ * bundles, and scheduled bundles are applied on the same thread as the
+ * other messages.
+ *
+ * Time tags are NTP time stamps, compared with the system clock.
+ */
+class bundle_scheduler final : public oscpack::TimerListener
+{
+public:
+  using clock = std::chrono::system_clock;
+  using apply_fun = std::function<void(
+      const oscpack::ReceivedBundle&, const oscpack::IpEndpointName&)>;
+
+  //! Resolution of the wheel, and period of the timer driving it
+  static constexpr int tick_ms = 1;
+
+  explicit bundle_scheduler(apply_fun f)
+      : m_apply{std::move(f)}, m_wheel{to_tick(clock::now())}
+  {
+  }
+
+  //! Time tag meaning "apply immediately"
+  static constexpr uint64_t immediate = 1;
+
+  static clock::time_point to_time_point(uint64_t ntp) noexcept
+  {
+    // Seconds between 1900-01-01 and 1970-01-01
+    constexpr uint64_t ntp_unix_offset = 2208988800ull;
+    using namespace std::chrono;
+
+    const int64_t secs = int64_t(ntp >> 32) - int64_t(ntp_unix_offset);
+    const uint64_t frac = ntp & 0xFFFFFFFF;
+    const auto ns = nanoseconds{int64_t((frac * 1000000000ull) >> 32)};
+    return clock::time_point{duration_cast<clock::duration>(seconds{secs} + ns)};
+  }
+
+  /**
+   * @brief Holds a copy of the bundle if its time tag is in the future
+   *
+   * @param top_level false for a bundle nested in another one, which is
+   * not counted as late: it was received with its parent, which was either
+   * already counted, or held until it was due.
+   *
+   * @return false if the bundle must be applied immediately.
+   */
+  bool schedule(
+      const oscpack::ReceivedBundle& b, const oscpack::IpEndpointName& ip,
+      bool top_level = true)
+  {
+    const auto tt = b.TimeTag();
+    if (tt == immediate || b.ElementCount() == 0)
+      return false;
+
+    const auto date = to_time_point(tt);
+    const auto now = clock::now();
+    if (date <= now)
+    {
+      if (!top_level)
+        return false;
+
+      using namespace std::chrono;
+      const auto lateness = duration_cast<microseconds>(now - date);
+      m_late.fetch_add(1, std::memory_order_relaxed);
+      m_totalLateness.fetch_add(lateness.count(), std::memory_order_relaxed);
+      if (lateness.count() > m_maxLateness.load(std::memory_order_relaxed))
+        m_maxLateness.store(lateness.count(), std::memory_order_relaxed);
+      return false;
+    }
+
+    m_wheel.insert(to_tick(date) + 1, pending_bundle{copy(b), ip});
+    m_scheduled.fetch_add(1, std::memory_order_relaxed);
+    m_pending.store(m_wheel.size(), std::memory_order_relaxed);
+    return true;
+  }
+
+  //! Applies the bundles which are due
+  void TimerExpired() override
+  {
+    m_wheel.advance(
+        to_tick(clock::now()), [this](uint64_t, pending_bundle&& p) {
+          try
+          {
+            oscpack::ReceivedPacket packet(p.data.data(), p.data.size());
+            m_apply(oscpack::ReceivedBundle(packet), p.endpoint);
+          }
+          catch (const std::exception& e)
+          {
+            ossia::logger().error("bundle_scheduler: {}", e.what());
+          }
+        });
+    m_pending.store(m_wheel.size(), std::memory_order_relaxed);
+  }
+
+  //! Number of bundles waiting for their time tag
+  std::size_t pending() const noexcept
+  {
+    return m_pending.load(std::memory_order_relaxed);
+  }
+
+  bundle_statistics statistics() const noexcept
+  {
+    bundle_statistics s;
+    s.scheduled = m_scheduled.load(std::memory_order_relaxed);
+    s.late = m_late.load(std::memory_order_relaxed);
+    s.max_lateness = std::chrono::microseconds{
+        m_maxLateness.load(std::memory_order_relaxed)};
+    s.total_lateness = std::chrono::microseconds{
+        m_totalLateness.load(std::memory_order_relaxed)};
+    return s;
+  }
+
+private:
+  struct pending_bundle
+  {
+    std::vector<char> data;
+    oscpack::IpEndpointName endpoint;
+  };
+
+  static uint64_t to_tick(clock::time_point t) noexcept
+  {
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(t.time_since_epoch()).count()
+           / tick_ms;
+  }
+
+  // The received bundle only points into the receive buffer, which is
+  // reused for the next packets.
+  static std::vector<char> copy(const oscpack::ReceivedBundle& b)
+  {
+    const char* elements = (*b.ElementsBegin()).Contents() - 4;
+    std::size_t size = 0;
+    for (auto it = b.ElementsBegin(); it != b.ElementsEnd(); ++it)
+      size += 4 + it->Size();
+
+    std::vector<char> res(16 + size);
+    std::memcpy(res.data(), "#bundle\0", 8);
+    const auto tt = b.TimeTag();
+    for (int i = 0; i < 8; i++)
+      res[8 + i] = char((tt >> (56 - 8 * i)) & 0xFF);
+    std::memcpy(res.data() + 16, elements, size);
+    return res;
+  }
+
+  apply_fun m_apply;
+  ossia::timer_wheel<pending_bundle> m_wheel;
+
+  std::atomic<std::size_t> m_pending{};
+  std::atomic<uint64_t> m_scheduled{};
+  std::atomic<uint64_t> m_late{};
+  std::atomic<int64_t> m_maxLateness{};
+  std::atomic<int64_t> m_totalLateness{};
+};
+}
+}
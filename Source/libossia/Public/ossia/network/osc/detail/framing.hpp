@@ -0,0 +1,234 @@
+#pragma once
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace ossia
+{
+namespace net
+{
+//! How OSC packets are delimited on a stream transport
+enum class osc_framing : uint8_t
+{
+  size_prefix, ///< OSC 1.0: each packet is preceded by its size, as a
+               ///< big-endian int32
+  slip         ///< OSC 1.1: packets are SLIP-encoded (RFC 1055)
+};
+
+namespace slip
+{
+constexpr char end = char(0xC0);
+constexpr char esc = char(0xDB);
+constexpr char esc_end = char(0xDC);
+constexpr char esc_esc = char(0xDD);
+}
+
+//! Appends a framed packet to a stream buffer
+inline void append_frame(
+    osc_framing framing, std::vector<char>& out, const char* data,
+    std::size_t sz)
+{
+  if (framing == osc_framing::size_prefix)
+  {
+    const auto pos = out.size();
+    out.resize(pos + 4 + sz);
+    char* p = out.data() + pos;
+    p[0] = char((sz >> 24) & 0xFF);
+    p[1] = char((sz >> 16) & 0xFF);
+    p[2] = char((sz >> 8) & 0xFF);
+    p[3] = char(sz & 0xFF);
+    std::memcpy(p + 4, data, sz);
+  }
+  else
+  {
+    // Double-ended, as recommended by OSC 1.1: a leading END flushes
+    // the noise that the receiver may have accumulated.
+    out.reserve(out.size() + sz + 2);
+    out.push_back(slip::end);
+    for (std::size_t i = 0; i < sz; i++)
+    {
+      switch (data[i])
+      {
+        case slip::end:
+          out.push_back(slip::esc);
+          out.push_back(slip::esc_end);
+          break;
+        case slip::esc:
+          out.push_back(slip::esc);
+          out.push_back(slip::esc_esc);
+          break;
+        default:
+          out.push_back(data[i]);
+          break;
+      }
+    }
+    out.push_back(slip::end);
+  }
+}
+
+/**
+ * @brief Splits a byte stream into OSC packets
+ *
+ * Bytes are read directly in the buffer of the decoder, at the location
+ * given by prepare(); commit() then calls a function for each packet
+ * completed by these bytes, with a pointer in the buffer : packets are
+ * not copied, SLIP packets being unescaped in place.
+ * Incomplete packets are kept until the following reads.
+ */
+class stream_decoder
+{
+public:
+  stream_decoder(osc_framing framing, std::size_t max_packet_size)
+      : m_framing{framing}, m_maxSize{max_packet_size}
+  {
+  }
+
+  /**
+   * @brief Free space where the next bytes have to be read
+   *
+   * The buffer grows as needed to hold a whole packet.
+   */
+  std::pair<char*, std::size_t> prepare(std::size_t min_size = 4096)
+  {
+    // Move the incomplete packet at the beginning of the buffer
+    if (m_begin > 0)
+    {
+      std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+      m_end -= m_begin;
+      m_write -= m_begin;
+      m_scan -= m_begin;
+      m_begin = 0;
+    }
+
+    const std::size_t needed = std::max(min_size, m_needed);
+    if (m_buffer.size() - m_end < needed)
+      m_buffer.resize(std::max(m_buffer.size() * 2, m_end + needed));
+
+    return {m_buffer.data() + m_end, m_buffer.size() - m_end};
+  }
+
+  /**
+   * @brief Parses the n bytes read at the location given by prepare()
+   *
+   * f(const char* data, std::size_t size) is called for each packet.
+   * @return false if the stream cannot be decoded anymore, i.e. a size
+   * prefix larger than the maximum packet size was received.
+   */
+  template <typename F>
+  bool commit(std::size_t n, F&& f)
+  {
+    m_end += n;
+    const bool ok = m_framing == osc_framing::size_prefix
+                        ? commit_size_prefix(f)
+                        : commit_slip(f);
+
+    if (m_begin == m_end)
+      m_begin = m_end = m_write = m_scan = 0;
+    return ok;
+  }
+
+private:
+  template <typename F>
+  bool commit_size_prefix(F& f)
+  {
+    m_needed = 0;
+    const char* data = m_buffer.data();
+    while (m_end - m_begin >= 4)
+    {
+      const auto* p = reinterpret_cast<const unsigned char*>(data + m_begin);
+      const std::size_t sz = (std::size_t(p[0]) << 24)
+                             | (std::size_t(p[1]) << 16)
+                             | (std::size_t(p[2]) << 8) | std::size_t(p[3]);
+      if (sz > m_maxSize)
+        return false;
+
+      if (m_end - m_begin - 4 < sz)
+      {
+        m_needed = 4 + sz - (m_end - m_begin);
+        break;
+      }
+
+      if (sz > 0)
+        f(data + m_begin + 4, sz);
+      m_begin += 4 + sz;
+    }
+    return true;
+  }
+
+  template <typename F>
+  bool commit_slip(F& f)
+  {
+    // m_scan: next input byte; m_write: end of the unescaped packet, which
+    // starts at m_begin. Unescaping only shrinks the packet, hence
+    // m_write <= m_scan.
+    char* data = m_buffer.data();
+    while (m_scan < m_end)
+    {
+      const char c = data[m_scan];
+      if (c == slip::end)
+      {
+        if (m_write > m_begin && !m_overflow)
+          f(data + m_begin, m_write - m_begin);
+
+        m_overflow = false;
+        m_begin = m_write = ++m_scan;
+        continue;
+      }
+
+      char out = c;
+      if (c == slip::esc)
+      {
+        // Wait for the escaped byte
+        if (m_scan + 1 == m_end)
+          break;
+
+        const char next = data[m_scan + 1];
+        out = next == slip::esc_end   ? slip::end
+              : next == slip::esc_esc ? slip::esc
+                                      : next;
+        m_scan += 2;
+      }
+      else
+      {
+        m_scan++;
+      }
+
+      if (m_write - m_begin >= m_maxSize)
+      {
+        // Skip the rest of a packet which is too large
+        m_overflow = true;
+        m_write = m_begin;
+      }
+      data[m_write++] = out;
+    }
+
+    if (m_overflow)
+    {
+      // The skipped packet is not kept, hence a stream without END bytes
+      // does not grow the buffer
+      std::memmove(data + m_begin, data + m_scan, m_end - m_scan);
+      m_end = m_begin + (m_end - m_scan);
+      m_write = m_scan = m_begin;
+    }
+    return true;
+  }
+
+  std::vector<char> m_buffer;
+  std::size_t m_begin{};
+  std::size_t m_end{};
+
+  // Size-prefix framing: bytes missing to complete the current packet
+  std::size_t m_needed{};
+
+  // SLIP framing
+  std::size_t m_write{};
+  std::size_t m_scan{};
+  bool m_overflow{};
+
+  osc_framing m_framing{};
+  std::size_t m_maxSize{};
+};
+}
+}
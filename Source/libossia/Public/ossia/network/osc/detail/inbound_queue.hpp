@@ -0,0 +1,97 @@
+#pragma once
+#include <ossia/detail/lockfree_queue.hpp>
+#include <ossia/network/value/value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ossia
+{
+namespace net
+{
+class parameter_base;
+
+//! A value decoded on the network thread, waiting to be applied.
+struct received_value
+{
+  //! If null, the message did not match any node and address is set.
+  //! If both are empty, the parameter was removed and the value is ignored.
+  ossia::net::parameter_base* parameter{};
+  ossia::value value;
+  std::string address;
+  //! When the message was decoded by the network thread
+  std::chrono::steady_clock::time_point timestamp;
+};
+
+/**
+ * @brief Bounded queue between the network thread and the thread
+ * applying received values.
+ *
+ * The network thread never blocks nor allocates a new block: when the queue
+ * is full the value is dropped and counted.
+ *
+ * Values are applied, and parameters removed, with dispatch_mutex locked.
+ * Queued values cannot be modified in place : remove() moves them to a
+ * vector, which is emptied before the queue.
+ */
+struct inbound_queue
+{
+  explicit inbound_queue(std::size_t capacity) : queue{capacity}
+  {
+  }
+
+  bool enqueue(received_value&& v)
+  {
+    if (queue.try_enqueue(std::move(v)))
+      return true;
+
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  //! Takes the next value in current
+  bool dequeue()
+  {
+    if (held_pos < held.size())
+    {
+      current = std::move(held[held_pos++]);
+      return true;
+    }
+
+    held.clear();
+    held_pos = 0;
+    return queue.try_dequeue(current);
+  }
+
+  //! Forgets the values of a parameter being removed
+  void remove(const ossia::net::parameter_base& p)
+  {
+    std::lock_guard lock{dispatch_mutex};
+    received_value v;
+    while (queue.try_dequeue(v))
+      held.push_back(std::move(v));
+
+    held.erase(
+        std::remove_if(
+            held.begin() + held_pos, held.end(),
+            [&](const received_value& v) { return v.parameter == &p; }),
+        held.end());
+    if (current.parameter == &p)
+      current.parameter = nullptr;
+  }
+
+  ossia::spsc_queue<received_value> queue;
+  std::atomic<std::size_t> dropped{};
+
+  // Recursive: callbacks called when applying values may remove parameters
+  std::recursive_mutex dispatch_mutex;
+  received_value current;
+  std::vector<received_value> held;
+  std::size_t held_pos{};
+};
+}
+}
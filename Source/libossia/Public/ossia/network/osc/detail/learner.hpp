@@ -0,0 +1,235 @@
+#pragma once
+#include <ossia/detail/algorithms.hpp>
+#include <ossia/detail/mutex.hpp>
+#include <ossia/detail/string_map.hpp>
+#include <ossia/network/base/device.hpp>
+#include <ossia/network/base/node.hpp>
+#include <ossia/network/base/parameter.hpp>
+#include <ossia/network/osc/detail/osc.hpp>
+#include <ossia/network/value/value.hpp>
+
+#include <tsl/hopscotch_set.h>
+
+#include <oscpack/ip/TimerListener.h>
+#include <oscpack/osc/OscReceivedElements.h>
+
+#include <string>
+#include <vector>
+
+namespace ossia
+{
+namespace net
+{
+/**
+ * @brief Creates the nodes matching the addresses of received messages
+ *
+ * Addresses already seen are found in a hash set, so that a source which
+ * keeps sending the same messages costs a single lookup per message.
+ * New addresses are queued, and the nodes are created by batches, either
+ * when the queue is full or when the timer is called on the receive
+ * thread; device_base::on_nodes_learned is called once for each batch,
+ * instead of on_node_created and on_parameter_created for each node.
+ *
+ * The learner lives as long as the device of the protocol, and is only
+ * given messages while learning : this way its timer stays attached to
+ * the receiver and learning is toggled without restarting it.
+ */
+class osc_learner final : public oscpack::TimerListener
+{
+public:
+  //! Period of the timer creating the pending nodes
+  static constexpr int flush_period_ms = 10;
+
+  //! Pending nodes are created as soon as there are this many
+  static constexpr std::size_t max_batch_size = 512;
+
+  explicit osc_learner(ossia::net::device_base& dev) : m_device{dev}
+  {
+    m_device.on_node_removing.connect<&osc_learner::on_node_removing>(this);
+  }
+
+  ~osc_learner() override
+  {
+    m_device.on_node_removing.disconnect<&osc_learner::on_node_removing>(
+        this);
+  }
+
+  osc_learner(const osc_learner&) = delete;
+  osc_learner& operator=(const osc_learner&) = delete;
+
+  //! Queues the address of the message if it was not seen yet
+  void learn(const oscpack::ReceivedMessage& m)
+  {
+    const ossia::string_view addr = m.AddressPattern();
+    std::size_t pending = 0;
+    {
+      lock_t lock{m_mutex};
+      if (m_known.find(addr) != m_known.end())
+        return;
+
+      // Known from now on: the node will be created with the first value
+      m_known.insert(std::string(addr));
+      m_pending.push_back({std::string(addr), learned_value(m)});
+      pending = m_pending.size();
+    }
+
+    if (pending >= max_batch_size)
+      flush();
+  }
+
+  void TimerExpired() override
+  {
+    flush();
+  }
+
+  //! Creates the nodes for all the queued addresses
+  void flush()
+  {
+    lock_t flush_lock{m_flushMutex};
+    {
+      lock_t lock{m_mutex};
+      if (m_pending.empty())
+        return;
+      m_batch.swap(m_pending);
+    }
+
+    // Nodes are created without holding m_mutex : the creation signals
+    // may remove nodes.
+    m_created.clear();
+    {
+      learned_batch batch{m_device};
+      for (auto& msg : m_batch)
+        create(msg.address, msg.value);
+    }
+
+    m_batch.clear();
+    if (!m_created.empty())
+      m_device.on_nodes_learned(m_created);
+  }
+
+private:
+  struct learned_message
+  {
+    std::string address;
+    ossia::value value;
+  };
+
+  struct learned_batch
+  {
+    explicit learned_batch(ossia::net::device_base& dev) : device{dev}
+    {
+      device.begin_learned_batch();
+    }
+    ~learned_batch()
+    {
+      device.end_learned_batch();
+    }
+    ossia::net::device_base& device;
+  };
+
+  template <std::size_t N>
+  static bool is_vec(const std::vector<ossia::value>& t)
+  {
+    return t.size() == N && ossia::all_of(t, [](const ossia::value& val) {
+             return val.get_type() == ossia::val_type::FLOAT;
+           });
+  }
+
+  template <std::size_t N>
+  static ossia::value vec_or_list(std::vector<ossia::value>&& list)
+  {
+    if (is_vec<N>(list))
+      return convert<std::array<float, N>>(list);
+    return std::move(list);
+  }
+
+  static ossia::value learned_value(const oscpack::ReceivedMessage& m)
+  {
+    switch (m.ArgumentCount())
+    {
+      case 0:
+        return ossia::impulse{};
+      case 1:
+        return osc_utilities::create_value(m.ArgumentsBegin());
+      case 2:
+        return vec_or_list<2>(
+            osc_utilities::create_list(m.ArgumentsBegin(), m.ArgumentsEnd()));
+      case 3:
+        return vec_or_list<3>(
+            osc_utilities::create_list(m.ArgumentsBegin(), m.ArgumentsEnd()));
+      case 4:
+        return vec_or_list<4>(
+            osc_utilities::create_list(m.ArgumentsBegin(), m.ArgumentsEnd()));
+      default:
+        return osc_utilities::create_list(
+            m.ArgumentsBegin(), m.ArgumentsEnd());
+    }
+  }
+
+  // Find-or-add algorithm.
+  // The created nodes are added to m_created, parents first.
+  void create(ossia::string_view addr, const ossia::value& val)
+  {
+    if (!addr.empty() && addr.front() == '/')
+      addr.remove_prefix(1);
+    if (!addr.empty() && addr.back() == '/')
+      addr.remove_suffix(1);
+    if (addr.empty())
+      return;
+
+    bool is_new = false;
+    node_base* n = &m_device.get_root_node();
+    while (n)
+    {
+      const auto slash = addr.find('/');
+      const auto part = addr.substr(0, slash);
+
+      if (auto cld = n->find_child(part))
+      {
+        n = cld;
+      }
+      else
+      {
+        // Start adding
+        n = n->create_child(std::string(part));
+        if (n)
+          m_created.push_back(n);
+        is_new = true;
+      }
+
+      if (slash == ossia::string_view::npos)
+        break;
+      addr.remove_prefix(slash + 1);
+    }
+
+    if (!n || !is_new)
+      return;
+
+    // Set-up address
+    auto param = n->create_parameter(val.get_type());
+    if (param && val.get_type() != ossia::val_type::IMPULSE)
+      param->set_value(val);
+  }
+
+  void on_node_removing(node_base&)
+  {
+    // The removed nodes will be learned again if they are still sent
+    lock_t lock{m_mutex};
+    m_known.clear();
+    m_known.reserve(m_pending.size());
+    for (const auto& msg : m_pending)
+      m_known.insert(msg.address);
+  }
+
+  ossia::net::device_base& m_device;
+
+  ossia::mutex_t m_mutex;
+  tsl::hopscotch_set<std::string, string_hash, string_equal> m_known;
+  std::vector<learned_message> m_pending;
+
+  ossia::mutex_t m_flushMutex;
+  std::vector<learned_message> m_batch;
+  std::vector<node_base*> m_created;
+};
+}
+}
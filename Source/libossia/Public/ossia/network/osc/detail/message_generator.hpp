@@ -1,11 +1,14 @@
 #pragma once
 #include <ossia/detail/small_vector.hpp>
+#include <ossia/network/base/encoded_message.hpp>
 #include <ossia/network/base/node_functions.hpp>
 #include <ossia/network/base/parameter.hpp>
 #include <ossia/network/base/parameter_data.hpp>
+#include <ossia/network/osc/detail/osc_fwd.hpp>
 
 #include <oscpack/osc/OscOutboundPacketStream.h>
 
+#include <algorithm>
 #include <array>
 #include <iostream>
 #include <vector>
@@ -99,6 +102,32 @@ private:
   oscpack::OutboundPacketStream p{buffer.data(), buffer.size()};
 };
 
+/**
+ * @brief Writes a message in a resizable buffer of char
+ *
+ * f(stream) writes the message. The buffer grows until it fits, and is
+ * then shrunk to the size of the message.
+ */
+template <typename Buffer, typename F>
+void write_message(Buffer& buffer, F&& f)
+{
+  buffer.resize(std::max<std::size_t>(buffer.capacity(), 256));
+  while (true)
+  {
+    try
+    {
+      oscpack::OutboundPacketStream p{buffer.data(), buffer.size()};
+      f(p);
+      buffer.resize(p.Size());
+      return;
+    }
+    catch (const oscpack::OutOfBufferMemoryException&)
+    {
+      buffer.resize(buffer.size() * 2);
+    }
+  }
+}
+
 // TODO have a queue of dynamic messages
 template <typename ValueWriter>
 class DynamicMessageGenerator
@@ -134,6 +163,13 @@ private:
   {
   }
 
+  template <typename... Args>
+  void subfunc(const ossia::value& arg1, Args&&... args)
+  {
+    arg1.apply(ValueWriter{{p}});
+    subfunc(args...);
+  }
+
   template <typename Arg1, typename... Args>
   void subfunc(Arg1&& arg1, Args&&... args)
   {
@@ -149,3 +185,26 @@ private:
   oscpack::OutboundPacketStream p{buffer.get(), 1024 * 1024};
 };
 }
+
+namespace ossia
+{
+namespace net
+{
+//! The OSC packet of a message, shared by the OSC protocols.
+//! Empty if the value is filtered.
+inline ossia::string_view osc_packet(encoded_message& msg)
+{
+  const auto& val = msg.filtered();
+  if (!val.valid())
+    return {};
+
+  return msg.get(encoded_message::osc, [&](encoded_message::buffer& buf) {
+    oscpack::write_message(buf, [&](oscpack::OutboundPacketStream& p) {
+      p << oscpack::BeginMessageN(msg.parameter.get_node().osc_address());
+      val.apply(osc_outbound_visitor{{p}});
+      p << oscpack::EndMessage();
+    });
+  });
+}
+}
+}
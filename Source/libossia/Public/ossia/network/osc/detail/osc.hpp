@@ -450,13 +450,105 @@ inline ossia::value to_value(
     return current.apply(osc_inbound_impulse_visitor{});
 }
 
+namespace detail
+{
+inline bool is_numeric_tag(char tag) noexcept
+{
+  switch (tag)
+  {
+    case oscpack::INT32_TYPE_TAG:
+    case oscpack::INT64_TYPE_TAG:
+    case oscpack::FLOAT_TYPE_TAG:
+    case oscpack::DOUBLE_TYPE_TAG:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <std::size_t N>
+inline bool read_vec(
+    oscpack::ReceivedMessageArgumentIterator it,
+    oscpack::ReceivedMessageArgumentIterator end, int num, ossia::value& res)
+{
+  if (num != int(N))
+    return false;
+
+  std::array<float, N> vec;
+  for (std::size_t i = 0; i < N; i++, ++it)
+  {
+    if (it == end || !is_numeric_tag(it->TypeTag()))
+      return false;
+    vec[i] = osc_utilities::get_float(it, 0.f);
+  }
+  res = vec;
+  return true;
+}
+}
+
+/**
+ * @brief Decodes the arguments of a message without reading the current value
+ *
+ * This handles the common cases where the type tags match the type of the
+ * parameter : a float or int parameter receiving a single number, a vecNf
+ * parameter receiving N numbers, and lists.
+ * These do not need a copy of the current value and do not allocate,
+ * except for lists.
+ *
+ * @return false if the generic conversion in ef to_value is needed.
+ */
+inline bool to_value_fast(
+    ossia::val_type type, oscpack::ReceivedMessageArgumentIterator beg_it,
+    oscpack::ReceivedMessageArgumentIterator end_it, int N, ossia::value& res)
+{
+  if (beg_it == end_it)
+    return false;
+
+  switch (type)
+  {
+    case ossia::val_type::FLOAT:
+      if (!detail::is_numeric_tag(beg_it->TypeTag()))
+        return false;
+      res = osc_utilities::get_float(beg_it, 0.f);
+      return true;
+    case ossia::val_type::INT:
+      if (!detail::is_numeric_tag(beg_it->TypeTag()))
+        return false;
+      res = osc_utilities::get_int(beg_it, 0);
+      return true;
+    case ossia::val_type::VEC2F:
+      return detail::read_vec<2>(beg_it, end_it, N, res);
+    case ossia::val_type::VEC3F:
+      return detail::read_vec<3>(beg_it, end_it, N, res);
+    case ossia::val_type::VEC4F:
+      return detail::read_vec<4>(beg_it, end_it, N, res);
+    case ossia::val_type::LIST:
+      // The list conversion does not depend on the current value
+      res = osc_utilities::create_list(beg_it, end_it);
+      return true;
+    default:
+      return false;
+  }
+}
+
+inline ossia::value to_value(
+    const ossia::net::parameter_base& addr,
+    oscpack::ReceivedMessageArgumentIterator beg_it,
+    oscpack::ReceivedMessageArgumentIterator end_it, int N)
+{
+  ossia::value res;
+  if (to_value_fast(addr.get_value_type(), beg_it, end_it, N, res))
+    return res;
+  return to_value(addr.value(), beg_it, end_it, N);
+}
+
 inline bool update_value(
     ossia::net::parameter_base& addr,
     oscpack::ReceivedMessageArgumentIterator beg_it,
     oscpack::ReceivedMessageArgumentIterator end_it, int N)
 {
   auto res = filter_value(
-      addr.get_domain(), ossia::net::to_value(addr.value(), beg_it, end_it, N),
+      addr.get_domain(), ossia::net::to_value(addr, beg_it, end_it, N),
       addr.get_bounding());
 
   if (res.valid())
@@ -480,7 +572,7 @@ inline bool update_value_quiet(
     oscpack::ReceivedMessageArgumentIterator end_it, int N)
 {
   auto res = filter_value(
-      addr.get_domain(), ossia::net::to_value(addr.value(), beg_it, end_it, N),
+      addr.get_domain(), ossia::net::to_value(addr, beg_it, end_it, N),
       addr.get_bounding());
 
   if (res.valid())
@@ -4,6 +4,8 @@
 #include <ossia/network/base/listening.hpp>
 #include <ossia/network/base/parameter.hpp>
 #include <ossia/network/common/network_logger.hpp>
+#include <ossia/network/common/packet_logger.hpp>
+#include <ossia/network/common/pattern_match_cache.hpp>
 #include <ossia/network/osc/detail/osc.hpp>
 
 #include <oscpack/osc/OscPrintReceivedElements.h>
@@ -18,9 +20,10 @@ template <bool SilentUpdate>
 inline void handle_osc_message(
     const oscpack::ReceivedMessage& m,
     const ossia::net::listened_parameters& listening,
-    ossia::net::device_base& dev, network_logger& logger)
+    ossia::net::device_base& dev, network_logger& logger,
+    pattern_match_cache* patterns = nullptr)
 {
-  auto addr_txt = m.AddressPattern();
+  const ossia::string_view addr_txt = m.AddressPattern();
   auto addr = listening.find(addr_txt);
 
   if (addr && *addr)
@@ -54,34 +57,50 @@ inline void handle_osc_message(
     else
     {
       // Try to handle pattern matching
-      auto nodes = find_nodes(dev.get_root_node(), addr_txt);
-      for (auto n : nodes)
+      auto update_matched = [&](ossia::net::parameter_base& addr) {
+        if (!SilentUpdate || listening.find(addr.get_node().osc_address()))
+        {
+          if (net::update_value(addr, m))
+            dev.on_message(addr);
+        }
+        else
+        {
+          if (net::update_value_quiet(addr, m))
+            dev.on_message(addr);
+        }
+      };
+
+      bool found = false;
+      if (patterns)
+      {
+        auto res = patterns->find(addr_txt);
+        for (auto addr : res->parameters)
+          update_matched(*addr);
+        found = res->found;
+      }
+      else
       {
-        if (auto addr = n->get_parameter())
+        auto nodes = find_nodes(dev.get_root_node(), addr_txt);
+        for (auto n : nodes)
         {
-          if (!SilentUpdate || listening.find(n->osc_address()))
-          {
-            if (net::update_value(*addr, m))
-              dev.on_message(*addr);
-          }
-          else
-          {
-            if (net::update_value_quiet(*addr, m))
-              dev.on_message(*addr);
-          }
+          if (auto addr = n->get_parameter())
+            update_matched(*addr);
         }
+        found = !nodes.empty();
       }
 
-      if (nodes.empty())
+      if (!found)
       {
         dev.on_unhandled_message(
-            addr_txt, net::osc_utilities::create_any(
+            std::string(addr_txt), net::osc_utilities::create_any(
                           m.ArgumentsBegin(), m.ArgumentsEnd(), m.ArgumentCount()));
       }
     }
   }
 
-  if (logger.inbound_logger)
+  if (logger.packet_log)
+    logger.packet_log->log(packet_logger::inbound, m.data(), m.size());
+  else if (logger.inbound_logger)
     logger.inbound_logger->info("In: {0}", m);
 }
 }
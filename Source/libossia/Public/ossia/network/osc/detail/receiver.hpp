@@ -10,6 +10,9 @@
 #include <memory>
 #include <sstream>
 #include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace oscpack
 {
@@ -113,6 +116,26 @@ public:
     }
   }
 
+  /**
+   * If the handler is also callable with a bundle and returns true,
+   * the bundle is considered handled : this is used to hold bundles
+   * until their time tag.
+   */
+  void ProcessBundle(
+      const oscpack::ReceivedBundle& b,
+      const oscpack::IpEndpointName& ip) override
+  {
+    if constexpr (std::is_invocable_r_v<
+                      bool, MessageHandler&, const oscpack::ReceivedBundle&,
+                      const oscpack::IpEndpointName&>)
+    {
+      if (m_messageHandler(b, ip))
+        return;
+    }
+
+    oscpack::OscPacketListener::ProcessBundle(b, ip);
+  }
+
   void ProcessPacket(
       const char* data, int size,
       const oscpack::IpEndpointName& remoteEndpoint) override
@@ -156,12 +179,26 @@ public:
     setPort(port);
   }
 
+  /**
+   * @param batch_size Maximum number of datagrams read in a single system
+   * call (recvmmsg on Linux) before they are dispatched to the handler.
+   */
+  template <typename Handler>
+  receiver(unsigned int port, int batch_size, Handler msg)
+      : m_batchSize{batch_size}
+      , m_impl{std::make_unique<listener<Handler>>(msg)}
+  {
+    setPort(port);
+  }
+
   receiver() = default;
   receiver(receiver&& other)
   {
     other.stop();
     m_impl = std::move(other.m_impl);
     m_socket = std::move(other.m_socket);
+    m_batchSize = other.m_batchSize;
+    m_timers = std::move(other.m_timers);
     setPort(other.m_port);
   }
 
@@ -171,6 +208,8 @@ public:
 
     m_impl = std::move(other.m_impl);
     m_socket = std::move(other.m_socket);
+    m_batchSize = other.m_batchSize;
+    m_timers = std::move(other.m_timers);
 
     setPort(other.m_port);
 
@@ -231,6 +270,23 @@ osc_thread_run:
     return m_port;
   }
 
+  int batchSize() const
+  {
+    return m_batchSize;
+  }
+
+  /**
+   * @brief Calls a timer periodically on the receive thread
+   *
+   * Timers must be added before run().
+   */
+  void addTimer(oscpack::TimerListener* timer, int periodMs)
+  {
+    m_timers.emplace_back(timer, periodMs);
+    if (m_socket)
+      m_socket->AttachPeriodicTimerListener(periodMs, timer);
+  }
+
   unsigned int setPort(unsigned int port)
   {
     m_port = port;
@@ -244,6 +300,9 @@ osc_thread_run:
             oscpack::IpEndpointName(
                 oscpack::IpEndpointName::ANY_ADDRESS, m_port),
             m_impl.get());
+        m_socket->SetReceiveBatchSize(m_batchSize);
+        for (auto [timer, period] : m_timers)
+          m_socket->AttachPeriodicTimerListener(period, timer);
         ok = true;
       }
       catch (std::runtime_error&)
@@ -257,6 +316,8 @@ osc_thread_run:
 
 private:
   unsigned int m_port = 0;
+  int m_batchSize = 1;
+  std::vector<std::pair<oscpack::TimerListener*, int>> m_timers;
   std::unique_ptr<oscpack::OscPacketListener> m_impl;
   std::unique_ptr<oscpack::ReceiveSocket> m_socket;
 
@@ -1,8 +1,10 @@
 #pragma once
 #include <ossia/detail/logger.hpp>
+#include <ossia/detail/mutex.hpp>
 #include <ossia/network/base/parameter.hpp>
 #include <ossia/network/base/parameter_data.hpp>
 #include <ossia/network/common/network_logger.hpp>
+#include <ossia/network/common/packet_logger.hpp>
 #include <ossia/network/osc/detail/message_generator.hpp>
 #include <ossia/network/value/format_value.hpp>
 
@@ -10,9 +12,11 @@
 #include <oscpack/osc/OscOutboundPacketStream.h>
 #include <oscpack/osc/OscPrintReceivedElements.h>
 
+#include <atomic>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 namespace osc
 {
 /**
@@ -34,6 +38,11 @@ public:
       , m_port(port)
   {
   }
+
+  ~sender()
+  {
+    flush();
+  }
   template <typename... Args>
   void send(const ossia::net::parameter_base& address, Args&&... args)
   {
@@ -77,6 +86,56 @@ public:
     return m_socket;
   }
 
+  /**
+   * @brief Enable outbound batching
+   *
+   * When enabled, encoded packets are appended to a staging buffer instead
+   * of being sent immediately, and go out in one batched system call
+   * (sendmmsg on Linux) on the next call to flush().
+   */
+  void set_batching(bool b)
+  {
+    m_batching = b;
+    if (!b)
+      flush();
+  }
+
+  bool batching() const noexcept
+  {
+    return m_batching;
+  }
+
+  //! Sends all the packets staged since the last flush.
+  void flush()
+  {
+    ossia::lock_t lck{m_stagingMutex};
+    flush_impl();
+  }
+
+  //! Sends an already-encoded packet, going through the staging buffer
+  //! if batching is enabled.
+  void send_raw(const char* data, std::size_t sz)
+  {
+    if (m_logger.packet_log)
+      m_logger.packet_log->log(
+          ossia::net::packet_logger::outbound, data, sz);
+
+    if (m_batching)
+    {
+      stage(data, sz);
+    }
+    else
+    {
+      try
+      {
+        m_socket.Send(data, sz);
+      }
+      catch (...)
+      {
+      }
+    }
+  }
+
 private:
   void debug(const oscpack::OutboundPacketStream& out)
   {
@@ -101,7 +160,7 @@ private:
       send_impl(m(args...));
     }
 
-    if (m_logger.outbound_logger)
+    if (m_logger.outbound_logger && !m_logger.packet_log)
     {
       std::string format_string;
       format_string.reserve(5 + 3 * sizeof...(args));
@@ -114,18 +173,60 @@ private:
 
   void send_impl(const oscpack::OutboundPacketStream& m)
   {
+    send_raw(m.Data(), m.Size());
+  }
+
+  void stage(const char* data, std::size_t sz)
+  {
+    ossia::lock_t lck{m_stagingMutex};
+    m_staging.insert(m_staging.end(), data, data + sz);
+    m_stagedSizes.push_back(sz);
+
+    // Do not let the staging buffer grow without bounds if flush()
+    // is never called, nor keep a packet staged by another thread while
+    // batching was being disabled.
+    if (m_staging.size() >= max_staging_size || !m_batching)
+      flush_impl();
+  }
+
+  void flush_impl()
+  {
+    if (m_stagedSizes.empty())
+      return;
+
+    m_stagedPackets.clear();
+    const char* ptr = m_staging.data();
+    for (std::size_t sz : m_stagedSizes)
+    {
+      m_stagedPackets.push_back(ptr);
+      ptr += sz;
+    }
+
     try
     {
-      m_socket.Send(m.Data(), m.Size());
+      m_socket.SendMany(
+          m_stagedPackets.data(), m_stagedSizes.data(),
+          m_stagedSizes.size());
     }
     catch (...)
     {
     }
+
+    m_staging.clear();
+    m_stagedSizes.clear();
   }
 
+  static constexpr std::size_t max_staging_size = 1024 * 1024;
+
   const ossia::net::network_logger& m_logger;
   oscpack::UdpTransmitSocket m_socket;
   std::string m_ip;
   int m_port;
+
+  ossia::mutex_t m_stagingMutex;
+  std::vector<char> m_staging;
+  std::vector<std::size_t> m_stagedSizes;
+  std::vector<const char*> m_stagedPackets;
+  std::atomic_bool m_batching{};
 };
 }
@@ -2,10 +2,15 @@
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
 #include <ossia/detail/logger.hpp>
 #include <ossia/network/base/parameter.hpp>
+#include <ossia/network/common/packet_logger.hpp>
 #include <ossia/network/domain/domain.hpp>
 #include <ossia/network/exceptions.hpp>
 #include <ossia/network/generic/generic_device.hpp>
 #include <ossia/network/generic/generic_parameter.hpp>
+#include <ossia/network/osc/detail/bundle.hpp>
+#include <ossia/network/osc/detail/bundle_scheduler.hpp>
+#include <ossia/network/osc/detail/inbound_queue.hpp>
+#include <ossia/network/osc/detail/learner.hpp>
 #include <ossia/network/osc/detail/osc.hpp>
 #include <ossia/network/osc/detail/osc_receive.hpp>
 #include <ossia/network/osc/detail/receiver.hpp>
@@ -23,10 +28,28 @@ namespace net
 {
 using sender_t = osc::sender<osc_outbound_visitor>;
 
+struct osc_protocol::receive_handler
+{
+  osc_protocol& self;
+
+  void operator()(
+      const oscpack::ReceivedMessage& m, const oscpack::IpEndpointName& ip)
+  {
+    self.on_received_message(m, ip);
+  }
+
+  bool operator()(
+      const oscpack::ReceivedBundle& b, const oscpack::IpEndpointName& ip)
+  {
+    return self.on_received_bundle(b, ip);
+  }
+};
+
 osc_protocol::osc_protocol(
     std::string ip, uint16_t remote_port, uint16_t local_port,
     std::optional<std::string> expose)
-    : m_ip{std::move(ip)}
+    : m_bundle{std::make_unique<bundle_encoder>()}
+    , m_ip{std::move(ip)}
     , m_remote_port{remote_port}
     , m_local_port{local_port}
     , m_expose{std::move(expose)}
@@ -38,6 +61,7 @@ osc_protocol::osc_protocol(
 
 osc_protocol::~osc_protocol()
 {
+  track_removals(false);
 }
 
 const std::string& osc_protocol::get_ip() const
@@ -82,18 +106,66 @@ osc_protocol& osc_protocol::set_local_port(uint16_t out_port)
   return *this;
 }
 
+int osc_protocol::get_receive_batch_size() const
+{
+  return m_receive_batch_size;
+}
+
+osc_protocol& osc_protocol::set_receive_batch_size(int sz)
+{
+  m_receive_batch_size = std::max(sz, 1);
+  update_receiver();
+
+  return *this;
+}
+
+std::size_t osc_protocol::get_max_bundle_size() const
+{
+  return m_bundle->max_size();
+}
+
+osc_protocol& osc_protocol::set_max_bundle_size(std::size_t sz)
+{
+  ossia::lock_t lck{m_bundleMutex};
+  m_bundle->set_max_size(sz);
+
+  return *this;
+}
+
+bool osc_protocol::outbound_batching() const
+{
+  return m_outbound_batching;
+}
+
+osc_protocol& osc_protocol::set_outbound_batching(bool b)
+{
+  m_outbound_batching = b;
+  m_sender->set_batching(b);
+
+  return *this;
+}
+
+void osc_protocol::flush()
+{
+  m_sender->flush();
+}
+
 void osc_protocol::update_sender()
 {
   m_sender = std::make_unique<sender_t>(m_logger, m_ip, m_remote_port);
+  m_sender->set_batching(m_outbound_batching);
 }
 
 void osc_protocol::update_receiver()
 {
+  // The previous socket has to be closed before the port can be bound again
+  m_receiver.reset();
   m_receiver = std::make_unique<osc::receiver>(
-      m_local_port, [this](const oscpack::ReceivedMessage& m,
-                        const oscpack::IpEndpointName& ip) {
-        this->on_received_message(m, ip);
-      });
+      m_local_port, m_receive_batch_size, receive_handler{*this});
+  if (m_scheduler)
+    m_receiver->addTimer(m_scheduler.get(), bundle_scheduler::tick_ms);
+  if (m_learner)
+    m_receiver->addTimer(m_learner.get(), osc_learner::flush_period_ms);
 
   if (m_receiver->port() != m_local_port)
   {
@@ -125,6 +197,117 @@ void osc_protocol::update_zeroconf()
   }
 }
 
+osc_protocol& osc_protocol::set_deferred_dispatch(std::size_t capacity)
+{
+  // The receive thread has to be stopped while the queue is replaced
+  m_receiver.reset();
+
+  track_removals(false);
+  m_inbound_capacity = capacity;
+  if (capacity > 0)
+    m_inbound = std::make_unique<inbound_queue>(capacity);
+  else
+    m_inbound.reset();
+  track_removals(true);
+
+  update_receiver();
+  return *this;
+}
+
+void osc_protocol::track_removals(bool b)
+{
+  if (!m_inbound || !m_device)
+    return;
+
+  if (b)
+    m_device->on_parameter_removing
+        .connect<&osc_protocol::parameter_removed>(this);
+  else
+    m_device->on_parameter_removing
+        .disconnect<&osc_protocol::parameter_removed>(this);
+}
+
+void osc_protocol::parameter_removed(const parameter_base& p)
+{
+  m_inbound->remove(p);
+}
+
+std::size_t osc_protocol::deferred_dispatch() const
+{
+  return m_inbound_capacity;
+}
+
+std::size_t osc_protocol::dropped_incoming() const
+{
+  return m_inbound ? m_inbound->dropped.load(std::memory_order_relaxed) : 0;
+}
+
+std::chrono::steady_clock::time_point osc_protocol::incoming_timestamp() const
+{
+  return m_inbound ? m_inbound->current.timestamp
+                   : std::chrono::steady_clock::time_point{};
+}
+
+std::size_t osc_protocol::process_incoming(std::size_t max_items)
+{
+  if (!m_inbound || !m_device)
+    return 0;
+
+  std::size_t n = 0;
+  std::lock_guard lock{m_inbound->dispatch_mutex};
+  auto& v = m_inbound->current;
+  while (n < max_items && m_inbound->dequeue())
+  {
+    n++;
+    if (v.parameter)
+    {
+      v.parameter->set_value(std::move(v.value));
+      // A callback may have removed the parameter
+      if (v.parameter)
+        m_device->on_message(*v.parameter);
+    }
+    else if (!v.address.empty())
+    {
+      m_device->on_unhandled_message(std::move(v.address), v.value);
+    }
+  }
+  return n;
+}
+
+bool osc_protocol::bundle_scheduling() const
+{
+  return bool(m_scheduler);
+}
+
+osc_protocol& osc_protocol::set_bundle_scheduling(bool b)
+{
+  if (b == bool(m_scheduler))
+    return *this;
+
+  // The timer runs on the receive thread
+  m_receiver.reset();
+
+  if (b)
+    m_scheduler = std::make_unique<bundle_scheduler>(
+        [this](const oscpack::ReceivedBundle& bundle,
+               const oscpack::IpEndpointName& ip) { apply_bundle(bundle, ip); });
+  else
+    m_scheduler.reset();
+
+  update_receiver();
+  return *this;
+}
+
+bundle_statistics osc_protocol::bundle_stats() const
+{
+  return m_scheduler ? m_scheduler->statistics() : bundle_statistics{};
+}
+
+std::size_t osc_protocol::pending_bundles() const
+{
+  return m_scheduler ? m_scheduler->pending() : 0;
+}
+
 bool osc_protocol::learning() const
 {
   return m_learning;
@@ -132,7 +315,18 @@ bool osc_protocol::learning() const
 
 osc_protocol& osc_protocol::set_learning(bool newLearn)
 {
+  if (newLearn == m_learning)
+    return *this;
+
+  // The learner's timer stays attached to the receiver: only the messages
+  // are routed differently.
   m_learning = newLearn;
+  if (!m_learning && m_learner)
+  {
+    // Create what was received before learning was disabled. A message
+    // being learned meanwhile is created on the next tick of the timer.
+    m_learner->flush();
+  }
   return *this;
 }
 
@@ -160,6 +354,15 @@ bool osc_protocol::push(const ossia::net::parameter_base& addr, const ossia::val
   return false;
 }
 
+bool osc_protocol::push_encoded(encoded_message& msg)
+{
+  return write_encoded(
+      msg, m_logger, [this](const char* data, std::size_t sz) {
+        m_sender->send_raw(data, sz);
+        return true;
+      });
+}
+
 bool osc_protocol::push_raw(const ossia::net::full_parameter_data& addr)
 {
   if (addr.get_access() == ossia::access_mode::GET)
@@ -177,70 +380,34 @@ bool osc_protocol::push_raw(const ossia::net::full_parameter_data& addr)
 bool osc_protocol::push_bundle(
     const std::vector<const parameter_base*>& addresses)
 {
-  constexpr int N = 1024 * 1024;
-
-  try
-  {
-    auto buffer{std::make_unique<char[]>(N)};
-    oscpack::OutboundPacketStream str(buffer.get(), N);
-    str << oscpack::BeginBundleImmediate();
-    for (auto a : addresses)
-    {
-      const ossia::net::parameter_base& addr = *a;
-      if (addr.get_access() == ossia::access_mode::GET)
-        continue;
-
-      ossia::value val = filter_value(addr, addr.value());
-      if (val.valid())
-      {
-        str << oscpack::BeginMessageN(addr.get_node().osc_address());
-        val.apply(osc_outbound_visitor{{str}});
-        str << oscpack::EndMessage();
-      }
-    }
-    str << oscpack::EndBundle();
-    m_sender->socket().Send(str.Data(), str.Size());
-  }
-  catch (const oscpack::OutOfBufferMemoryException&)
-  {
-    return false;
-  }
+  ossia::lock_t lck{m_bundleMutex};
+  return write_bundle(
+      *m_bundle, addresses, [this](const char* data, std::size_t sz) {
+        m_sender->send_raw(data, sz);
+        return true;
+      });
+}
 
-  return true;
+bool osc_protocol::push_bundle_values(
+    const std::vector<std::pair<const parameter_base*, ossia::value>>& values)
+{
+  ossia::lock_t lck{m_bundleMutex};
+  return write_bundle_values(
+      *m_bundle, values, [this](const char* data, std::size_t sz) {
+        m_sender->send_raw(data, sz);
+        return true;
+      });
 }
 
 bool osc_protocol::push_raw_bundle(
     const std::vector<ossia::net::full_parameter_data>& addresses)
 {
-  constexpr int N = 1024 * 1024;
-
-  try
-  {
-    auto buffer{std::make_unique<char[]>(N)};
-    oscpack::OutboundPacketStream str(buffer.get(), N);
-    str << oscpack::BeginBundleImmediate();
-    for (const auto& addr : addresses)
-    {
-      if (addr.get_access() == ossia::access_mode::GET)
-        continue;
-
-      ossia::value val = filter_value(addr, addr.value());
-      if (val.valid())
-      {
-        str << oscpack::BeginMessageN(addr.address);
-        val.apply(osc_outbound_visitor{{str}});
-        str << oscpack::EndMessage();
-      }
-    }
-    str << oscpack::EndBundle();
-    m_sender->socket().Send(str.Data(), str.Size());
-  }
-  catch (const oscpack::OutOfBufferMemoryException&)
-  {
-    return false;
-  }
-
-  return true;
+  ossia::lock_t lck{m_bundleMutex};
+  return write_raw_bundle(
+      *m_bundle, addresses, [this](const char* data, std::size_t sz) {
+        m_sender->send_raw(data, sz);
+        return true;
+      });
 }
 
 bool osc_protocol::observe(ossia::net::parameter_base& address, bool enable)
@@ -257,131 +424,112 @@ bool osc_protocol::observe(ossia::net::parameter_base& address, bool enable)
 void osc_protocol::on_received_message(
     const oscpack::ReceivedMessage& m, const oscpack::IpEndpointName& ip)
 {
-  if (!m_learning)
+  if (m_inbound && !m_learning)
   {
-    handle_osc_message<false>(m, m_listening, *m_device, m_logger);
+    enqueue_received_message(m);
   }
-  else
+  else if (!m_learning)
+  {
+    handle_osc_message<false>(
+        m, m_listening, *m_device, m_logger, m_patterns.get());
+  }
+  else if (m_learner)
   {
-    on_learn(m);
+    m_learner->learn(m);
   }
 }
 
-template <std::size_t N>
-static bool is_vec(std::vector<ossia::value>& t)
+bool osc_protocol::on_received_bundle(
+    const oscpack::ReceivedBundle& b, const oscpack::IpEndpointName& ip)
 {
-  return t.size() == N && ossia::all_of(t, [](const ossia::value& val) {
-           return val.get_type() == ossia::val_type::FLOAT;
-         });
+  if (!m_scheduler)
+    return false;
+
+  // Bundles which are due are applied here rather than by the listener, so
+  // that their nested bundles are scheduled as such and not counted as late.
+  if (!m_scheduler->schedule(b, ip))
+    apply_bundle(b, ip);
+  return true;
 }
 
-void osc_protocol::on_learn(const oscpack::ReceivedMessage& m)
+void osc_protocol::apply_bundle(
+    const oscpack::ReceivedBundle& b, const oscpack::IpEndpointName& ip)
 {
-  // TODO put them in a hash map instead.
-  // Find-or-add algorithm
-  ossia::string_view addr = m.AddressPattern();
-  // TODO string -> string_view
-  std::vector<std::string> v = address_parts(addr);
-
-  bool is_new = false;
-  node_base* n = &m_device->get_root_node();
-  for (const auto& part : v)
+  for (auto it = b.ElementsBegin(); it != b.ElementsEnd(); ++it)
   {
-    auto cld = n->find_child(part);
-    if (cld)
+    if (it->IsBundle())
     {
-      n = cld;
+      // Nested bundles may be dated later than their parent
+      oscpack::ReceivedBundle nested{*it};
+      if (!m_scheduler || !m_scheduler->schedule(nested, ip, false))
+        apply_bundle(nested, ip);
     }
     else
     {
-      // Start adding
-      n = n->create_child(part);
-      is_new = true;
+      on_received_message(oscpack::ReceivedMessage{*it}, ip);
     }
   }
+}
 
-  if (!is_new)
-    return;
+void osc_protocol::enqueue_received_message(const oscpack::ReceivedMessage& m)
+{
+  const ossia::string_view addr_txt = m.AddressPattern();
+  const auto now = std::chrono::steady_clock::now();
+
+  auto push = [&](ossia::net::parameter_base& addr) {
+    auto res = filter_value(
+        addr.get_domain(),
+        ossia::net::to_value(
+            addr, m.ArgumentsBegin(), m.ArgumentsEnd(), m.ArgumentCount()),
+        addr.get_bounding());
+
+    if (res.valid())
+      m_inbound->enqueue(received_value{&addr, std::move(res), {}, now});
+  };
 
-  // Set-up address
-  switch (m.ArgumentCount())
+  if (auto addr = m_listening.find(addr_txt); addr && *addr)
   {
-    case 0:
-    {
-      n->create_parameter();
-      break;
-    }
-    case 1:
-    {
-      auto val = osc_utilities::create_value(m.ArgumentsBegin());
-      auto addr = n->create_parameter(val.get_type());
-      addr->set_value(val);
-      break;
-    }
-    case 2:
-    {
-      auto val
-          = osc_utilities::create_list(m.ArgumentsBegin(), m.ArgumentsEnd());
-      if (is_vec<2>(val))
-      {
-        auto addr = n->create_parameter(ossia::val_type::VEC2F);
-        addr->set_value(convert<ossia::vec2f>(val));
-      }
-      else
-      {
-        auto addr = n->create_parameter(ossia::val_type::LIST);
-        addr->set_value(
-            osc_utilities::create_list(m.ArgumentsBegin(), m.ArgumentsEnd()));
-      }
-      break;
-    }
-    case 3:
-    {
-      auto val
-          = osc_utilities::create_list(m.ArgumentsBegin(), m.ArgumentsEnd());
-      if (is_vec<3>(val))
-      {
-        auto addr = n->create_parameter(ossia::val_type::VEC3F);
-        addr->set_value(convert<ossia::vec3f>(val));
-      }
-      else
-      {
-        auto addr = n->create_parameter(ossia::val_type::LIST);
-        addr->set_value(
-            osc_utilities::create_list(m.ArgumentsBegin(), m.ArgumentsEnd()));
-      }
-      break;
-    }
-    case 4:
-    {
-      auto val
-          = osc_utilities::create_list(m.ArgumentsBegin(), m.ArgumentsEnd());
-      if (is_vec<4>(val))
-      {
-        auto addr = n->create_parameter(ossia::val_type::VEC4F);
-        addr->set_value(convert<ossia::vec4f>(val));
-      }
-      else
-      {
-        auto addr = n->create_parameter(ossia::val_type::LIST);
-        addr->set_value(
-            osc_utilities::create_list(m.ArgumentsBegin(), m.ArgumentsEnd()));
-      }
-      break;
-    }
-    default:
+    push(**addr);
+  }
+  else if (auto n = find_node(m_device->get_root_node(), addr_txt))
+  {
+    if (auto addr = n->get_parameter())
+      push(*addr);
+  }
+  else
+  {
+    auto res = m_patterns->find(addr_txt);
+    for (auto addr : res->parameters)
+      push(*addr);
+
+    if (!res->found)
     {
-      auto addr = n->create_parameter(ossia::val_type::LIST);
-      addr->set_value(
-          osc_utilities::create_list(m.ArgumentsBegin(), m.ArgumentsEnd()));
-      break;
+      m_inbound->enqueue(received_value{
+          nullptr,
+          osc_utilities::create_any(
+              m.ArgumentsBegin(), m.ArgumentsEnd(), m.ArgumentCount()),
+          std::string(addr_txt), now});
     }
   }
+
+  if (m_logger.packet_log)
+    m_logger.packet_log->log(packet_logger::inbound, m.data(), m.size());
+  else if (m_logger.inbound_logger)
+    m_logger.inbound_logger->info("In: {0}", m);
 }
 
 void osc_protocol::set_device(device_base& dev)
 {
+  track_removals(false);
+  m_patterns.reset();
   m_device = &dev;
+  track_removals(true);
+  m_patterns = std::make_unique<pattern_match_cache>(dev);
+
+  // The learner's timer has to be attached before the receiver runs
+  m_receiver.reset();
+  m_learner = std::make_unique<osc_learner>(dev);
+  update_receiver();
 }
 }
 }
@@ -7,11 +7,14 @@
 #include <tsl/hopscotch_map.h>
 
 #include <atomic>
+#include <chrono>
+#include <limits>
 #include <string>
 
 namespace oscpack
 {
 class ReceivedMessage;
+class ReceivedBundle;
 class IpEndpointName;
 }
 namespace osc
@@ -25,6 +28,27 @@ namespace ossia
 namespace net
 {
 struct osc_outbound_visitor;
+class bundle_encoder;
+class pattern_match_cache;
+struct inbound_queue;
+class bundle_scheduler;
+class osc_learner;
+
+//! Statistics about received bundles with a time tag
+struct bundle_statistics
+{
+  //! Bundles held until their time tag
+  uint64_t scheduled{};
+
+  //! Bundles received after their time tag, applied immediately
+  uint64_t late{};
+
+  //! Largest and cumulated delay between the time tag and the reception of
+  //! the late bundles
+  std::chrono::microseconds max_lateness{};
+  std::chrono::microseconds total_lateness{};
+};
+
 class OSSIA_EXPORT osc_protocol final : public ossia::net::protocol_base
 {
 public:
@@ -48,6 +72,79 @@ public:
   uint16_t get_local_port() const;
   osc_protocol& set_local_port(uint16_t);
 
+  int get_receive_batch_size() const;
+  osc_protocol& set_receive_batch_size(int);
+
+  //! Maximum size in bytes of the bundles sent by push_bundle.
+  //! Larger sets of parameters are split across several bundles.
+  std::size_t get_max_bundle_size() const;
+  osc_protocol& set_max_bundle_size(std::size_t);
+
+  bool outbound_batching() const;
+  osc_protocol& set_outbound_batching(bool);
+
+  //! Sends the messages staged since the last flush when outbound batching
+  //! is enabled, e.g. once at the end of each frame.
+  void flush();
+
+  /**
+   * @brief Defer the application of received values
+   *
+   * With a non-zero capacity, the network thread only decodes received
+   * messages into a queue of this many values (rounded up by the queue
+   * implementation); they are applied to
+   * the parameters, and callbacks are called, by process_incoming.
+   * Values received while the queue is full are dropped.
+   *
+   * The values queued for a parameter are discarded when it is removed.
+   */
+  osc_protocol& set_deferred_dispatch(std::size_t capacity);
+  std::size_t deferred_dispatch() const;
+
+  /**
+   * @brief Applies at most max_items values received since the last call.
+   * @return the number of values processed.
+   */
+  std::size_t process_incoming(
+      std::size_t max_items = std::numeric_limits<std::size_t>::max());
+
+  /**
+   * @brief Time at which the value being applied was received
+   *
+   * Only meaningful when called from the callbacks run by process_incoming,
+   * e.g. to order values or discard the ones which are too old.
+   */
+  std::chrono::steady_clock::time_point incoming_timestamp() const;
+
+  //! Number of received values dropped because the queue was full
+  std::size_t dropped_incoming() const;
+
+  /**
+   * @brief Apply received bundles at the time given by their time tag
+   *
+   * When enabled, bundles dated in the future are held and applied once the
+   * system clock reaches their time tag, with a 1 ms resolution.
+   * Bundles received after their time tag are applied immediately and
+   * counted in bundle_stats().
+   * When disabled (the default), time tags are ignored.
+   */
+  bool bundle_scheduling() const;
+  osc_protocol& set_bundle_scheduling(bool);
+
+  bundle_statistics bundle_stats() const;
+
+  //! Number of bundles waiting for their time tag
+  std::size_t pending_bundles() const;
+
+  /**
+   * @brief Create the nodes matching the received messages
+   *
+   * While learning, received messages are not applied to the parameters:
+   * nodes and parameters are created for the addresses which do not exist
+   * yet, by batches, on the receive thread. Toggling it does not restart
+   * the receiver.
+   * \see device_base::on_nodes_learned
+   */
   bool learning() const;
   osc_protocol& set_learning(bool);
 
@@ -60,15 +157,26 @@ public:
   push_raw(const ossia::net::full_parameter_data& parameter_base) override;
   bool
   push_bundle(const std::vector<const ossia::net::parameter_base*>&) override;
+  bool push_bundle_values(
+      const std::vector<std::pair<const parameter_base*, ossia::value>>&)
+      override;
+  bool push_encoded(encoded_message&) override;
   bool push_raw_bundle(const std::vector<full_parameter_data>&) override;
 
   bool
   observe(ossia::net::parameter_base& parameter_base, bool enable) override;
 
 private:
+  struct receive_handler;
   void on_received_message(
       const oscpack::ReceivedMessage& m, const oscpack::IpEndpointName& ip);
-  void on_learn(const oscpack::ReceivedMessage& m);
+  bool on_received_bundle(
+      const oscpack::ReceivedBundle& b, const oscpack::IpEndpointName& ip);
+  void apply_bundle(
+      const oscpack::ReceivedBundle& b, const oscpack::IpEndpointName& ip);
+  void enqueue_received_message(const oscpack::ReceivedMessage& m);
+  void track_removals(bool);
+  void parameter_removed(const ossia::net::parameter_base&);
   void set_device(ossia::net::device_base& dev) override;
 
   void update_sender();
@@ -76,10 +184,18 @@ private:
   void update_zeroconf();
 
   listened_parameters m_listening;
+  std::unique_ptr<pattern_match_cache> m_patterns;
+  std::unique_ptr<inbound_queue> m_inbound;
+  std::size_t m_inbound_capacity{};
+  std::unique_ptr<bundle_scheduler> m_scheduler;
+  std::unique_ptr<osc_learner> m_learner;
 
   std::unique_ptr<osc::sender<osc_outbound_visitor>> m_sender;
   std::unique_ptr<osc::receiver> m_receiver;
 
+  ossia::mutex_t m_bundleMutex;
+  std::unique_ptr<bundle_encoder> m_bundle;
+
   net::zeroconf_server m_zeroconfServer;
 
   ossia::net::device_base* m_device{};
@@ -88,6 +204,10 @@ private:
   uint16_t m_remote_port{}; /// the port that a remote device opens
   uint16_t m_local_port{};  /// the port where a remote device sends OSC
                            /// messages to (opened in this library)
+  int m_receive_batch_size{1}; /// datagrams read per system call on the
+                               /// receive thread
+  bool m_outbound_batching{}; /// if outbound messages are staged until
+                              /// flush() is called
   std::atomic_bool m_learning{}; /// if the device is currently learning from
                                  /// inbound messages.
   std::optional<std::string> m_expose{};
@@ -0,0 +1,500 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <ossia/detail/logger.hpp>
+#include <ossia/network/base/device.hpp>
+#include <ossia/network/base/parameter.hpp>
+#include <ossia/network/common/packet_logger.hpp>
+#include <ossia/network/common/pattern_match_cache.hpp>
+#include <ossia/network/exceptions.hpp>
+#include <ossia/network/osc/detail/bundle.hpp>
+#include <ossia/network/osc/detail/message_generator.hpp>
+#include <ossia/network/osc/detail/osc.hpp>
+#include <ossia/network/osc/detail/osc_receive.hpp>
+#include <ossia/network/osc/detail/receiver.hpp>
+#include <ossia/network/osc/osc_tcp.hpp>
+#include <ossia/network/value/format_value.hpp>
+
+#include <asio.hpp>
+
+#include <future>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace ossia
+{
+namespace net
+{
+using tcp = asio::ip::tcp;
+
+namespace
+{
+// Delay before connecting again to the server
+constexpr auto reconnect_interval = std::chrono::seconds(1);
+
+// Bundles do not have to fit in a datagram
+constexpr std::size_t stream_bundle_size = 64 * 1024;
+}
+
+struct osc_tcp_protocol::context
+{
+  asio::io_context io;
+  asio::executor_work_guard<asio::io_context::executor_type> work{
+      io.get_executor()};
+  std::optional<tcp::acceptor> acceptor;
+  tcp::resolver resolver{io};
+  asio::steady_timer reconnect{io};
+  std::thread thread;
+  bool connect_failed{};
+
+  mutable ossia::mutex_t mutex;
+  std::vector<std::shared_ptr<connection>> connections;
+};
+
+/**
+ * A connected socket. Outbound packets are framed in a pending buffer,
+ * which is written as a whole once the previous write has completed.
+ */
+struct osc_tcp_protocol::connection
+    : std::enable_shared_from_this<connection>
+{
+  connection(osc_tcp_protocol& p, tcp::socket s)
+      : protocol{p}
+      , socket{std::move(s)}
+      , decoder{p.m_framing, max_packet_size}
+  {
+    asio::error_code ec;
+    // Small messages are coalesced by the connection itself
+    socket.set_option(tcp::no_delay{true}, ec);
+
+    auto ep = socket.remote_endpoint(ec);
+    if (!ec && ep.address().is_v4())
+      endpoint = oscpack::IpEndpointName(
+          ep.address().to_v4().to_ulong(), ep.port());
+  }
+
+  void read()
+  {
+    auto buf = decoder.prepare();
+    socket.async_read_some(
+        asio::buffer(buf.first, buf.second),
+        [c = shared_from_this()](const asio::error_code& ec, std::size_t n) {
+          if (ec)
+          {
+            c->close();
+            return;
+          }
+
+          auto& listener = *c->protocol.m_listener;
+          const bool ok
+              = c->decoder.commit(n, [&](const char* data, std::size_t sz) {
+                  listener.ProcessPacket(data, int(sz), c->endpoint);
+                });
+
+          if (!ok)
+          {
+            ossia::logger().error(
+                "osc_tcp_protocol: packet larger than {} bytes, closing the "
+                "connection",
+                max_packet_size);
+            c->close();
+            return;
+          }
+
+          c->read();
+        });
+  }
+
+  bool send(const char* data, std::size_t sz)
+  {
+    ossia::lock_t lck{mutex};
+    // The bytes being written are still queued in the socket's memory
+    if (closed || inflight_size + pending.size() + sz > max_queued_size)
+      return false;
+
+    append_frame(protocol.m_framing, pending, data, sz);
+    if (!writing)
+    {
+      writing = true;
+      asio::post(socket.get_executor(), [c = shared_from_this()] { c->write(); });
+    }
+    return true;
+  }
+
+  void write()
+  {
+    {
+      ossia::lock_t lck{mutex};
+      inflight_size = 0;
+      if (pending.empty() || closed)
+      {
+        writing = false;
+        return;
+      }
+      inflight.clear();
+      inflight.swap(pending);
+      inflight_size = inflight.size();
+    }
+
+    asio::async_write(
+        socket, asio::buffer(inflight),
+        [c = shared_from_this()](const asio::error_code& ec, std::size_t) {
+          if (ec)
+            c->close();
+          else
+            c->write();
+        });
+  }
+
+  void close()
+  {
+    {
+      ossia::lock_t lck{mutex};
+      if (closed)
+        return;
+      closed = true;
+      pending.clear();
+    }
+
+    asio::error_code ec;
+    socket.shutdown(tcp::socket::shutdown_both, ec);
+    socket.close(ec);
+    protocol.remove_connection(*this);
+  }
+
+  osc_tcp_protocol& protocol;
+  tcp::socket socket;
+  oscpack::IpEndpointName endpoint;
+  stream_decoder decoder;
+
+  ossia::mutex_t mutex;
+  std::vector<char> pending;
+  std::vector<char> inflight;
+  std::size_t inflight_size{}; // inflight is only read outside of the mutex
+  bool writing{};
+  bool closed{};
+};
+
+struct osc_tcp_protocol::receive_handler
+{
+  osc_tcp_protocol& self;
+
+  void operator()(
+      const oscpack::ReceivedMessage& m, const oscpack::IpEndpointName& ip)
+  {
+    if (self.m_device)
+      handle_osc_message<false>(
+          m, self.m_listening, *self.m_device, self.m_logger,
+          self.m_patterns.get());
+  }
+};
+
+osc_tcp_protocol::osc_tcp_protocol(
+    std::string host, uint16_t port, osc_framing framing)
+    : m_listener{std::make_unique<osc::listener<receive_handler>>(
+        receive_handler{*this})}
+    , m_context{std::make_unique<context>()}
+    , m_bundle{std::make_unique<bundle_encoder>(stream_bundle_size)}
+    , m_host{std::move(host)}
+    , m_port{port}
+    , m_framing{framing}
+{
+}
+
+osc_tcp_protocol::osc_tcp_protocol(uint16_t local_port, osc_framing framing)
+    : m_listener{std::make_unique<osc::listener<receive_handler>>(
+        receive_handler{*this})}
+    , m_context{std::make_unique<context>()}
+    , m_bundle{std::make_unique<bundle_encoder>(stream_bundle_size)}
+    , m_port{local_port}
+    , m_framing{framing}
+    , m_server{true}
+{
+  try
+  {
+    m_context->acceptor.emplace(
+        m_context->io, tcp::endpoint(tcp::v4(), local_port));
+  }
+  catch (const std::exception& e)
+  {
+    throw ossia::connection_error{
+        "osc_tcp_protocol: "
+        "Could not open port: "
+        + std::to_string(local_port) + ": " + e.what()};
+  }
+}
+
+osc_tcp_protocol::~osc_tcp_protocol()
+{
+  stop();
+}
+
+osc_framing osc_tcp_protocol::get_framing() const
+{
+  return m_framing;
+}
+
+std::size_t osc_tcp_protocol::connections() const
+{
+  ossia::lock_t lck{m_context->mutex};
+  return m_context->connections.size();
+}
+
+uint64_t osc_tcp_protocol::dropped_outbound() const
+{
+  return m_dropped.load(std::memory_order_relaxed);
+}
+
+void osc_tcp_protocol::stop()
+{
+  if (!m_context->thread.joinable())
+    return;
+
+  m_context->work.reset();
+  m_context->io.stop();
+  m_context->thread.join();
+
+  ossia::lock_t lck{m_context->mutex};
+  m_context->connections.clear();
+}
+
+void osc_tcp_protocol::connect()
+{
+  m_context->resolver.async_resolve(
+      m_host, std::to_string(m_port),
+      [this](
+          const asio::error_code& ec,
+          const tcp::resolver::results_type& endpoints) {
+        if (ec)
+        {
+          reconnect_later();
+          return;
+        }
+
+        auto sock = std::make_shared<tcp::socket>(m_context->io);
+        asio::async_connect(
+            *sock, endpoints,
+            [this, sock](const asio::error_code& ec, const tcp::endpoint&) {
+              if (ec)
+              {
+                if (!m_context->connect_failed)
+                  ossia::logger().warn(
+                      "osc_tcp_protocol: could not connect to {}:{}: {}",
+                      m_host, m_port, ec.message());
+                m_context->connect_failed = true;
+                reconnect_later();
+                return;
+              }
+
+              m_context->connect_failed = false;
+              add_connection(
+                  std::make_shared<connection>(*this, std::move(*sock)));
+            });
+      });
+}
+
+void osc_tcp_protocol::reconnect_later()
+{
+  m_context->reconnect.expires_after(reconnect_interval);
+  m_context->reconnect.async_wait([this](const asio::error_code& ec) {
+    if (!ec)
+      connect();
+  });
+}
+
+void osc_tcp_protocol::accept()
+{
+  m_context->acceptor->async_accept(
+      [this](const asio::error_code& ec, tcp::socket socket) {
+        if (ec == asio::error::operation_aborted)
+          return;
+
+        if (!ec)
+          add_connection(
+              std::make_shared<connection>(*this, std::move(socket)));
+        accept();
+      });
+}
+
+void osc_tcp_protocol::add_connection(std::shared_ptr<connection> c)
+{
+  {
+    ossia::lock_t lck{m_context->mutex};
+    m_context->connections.push_back(c);
+  }
+  c->read();
+}
+
+void osc_tcp_protocol::remove_connection(const connection& c)
+{
+  {
+    ossia::lock_t lck{m_context->mutex};
+    auto& cs = m_context->connections;
+    cs.erase(
+        std::remove_if(
+            cs.begin(), cs.end(), [&](const auto& ptr) { return ptr.get() == &c; }),
+        cs.end());
+  }
+
+  if (!m_server)
+    reconnect_later();
+}
+
+bool osc_tcp_protocol::update(ossia::net::node_base& node)
+{
+  return false;
+}
+
+bool osc_tcp_protocol::pull(ossia::net::parameter_base& address)
+{
+  return false;
+}
+
+bool osc_tcp_protocol::push(
+    const ossia::net::parameter_base& addr, const ossia::value& v)
+{
+  if (addr.get_access() == ossia::access_mode::GET)
+    return false;
+
+  auto val = filter_value(addr, v);
+  if (val.valid())
+    return send_message(addr.get_node().osc_address(), val);
+  return false;
+}
+
+bool osc_tcp_protocol::push_encoded(encoded_message& msg)
+{
+  return write_encoded(
+      msg, m_logger, [this](const char* data, std::size_t sz) {
+        return send(data, sz);
+      });
+}
+
+bool osc_tcp_protocol::push_raw(const ossia::net::full_parameter_data& addr)
+{
+  if (addr.get_access() == ossia::access_mode::GET)
+    return false;
+
+  auto val = filter_value(addr, addr.value());
+  if (val.valid())
+    return send_message(addr.address, val);
+  return false;
+}
+
+bool osc_tcp_protocol::push_bundle(
+    const std::vector<const parameter_base*>& addresses)
+{
+  ossia::lock_t lck{m_bundleMutex};
+  return write_bundle(
+      *m_bundle, addresses, [this](const char* data, std::size_t sz) {
+        return send(data, sz);
+      });
+}
+
+bool osc_tcp_protocol::push_bundle_values(
+    const std::vector<std::pair<const parameter_base*, ossia::value>>& values)
+{
+  ossia::lock_t lck{m_bundleMutex};
+  return write_bundle_values(
+      *m_bundle, values, [this](const char* data, std::size_t sz) {
+        return send(data, sz);
+      });
+}
+
+bool osc_tcp_protocol::push_raw_bundle(
+    const std::vector<ossia::net::full_parameter_data>& addresses)
+{
+  ossia::lock_t lck{m_bundleMutex};
+  return write_raw_bundle(
+      *m_bundle, addresses, [this](const char* data, std::size_t sz) {
+        return send(data, sz);
+      });
+}
+
+bool osc_tcp_protocol::observe(
+    ossia::net::parameter_base& address, bool enable)
+{
+  if (enable)
+    m_listening.insert(
+        std::make_pair(address.get_node().osc_address(), &address));
+  else
+    m_listening.erase(address.get_node().osc_address());
+
+  return true;
+}
+
+bool osc_tcp_protocol::send_message(
+    ossia::string_view address, const ossia::value& val)
+{
+  bool ok = false;
+  try
+  {
+    oscpack::MessageGenerator<osc_outbound_visitor> m;
+    const auto& str = m(address, val);
+    ok = send(str.Data(), str.Size());
+  }
+  catch (const oscpack::OutOfBufferMemoryException&)
+  {
+    // Grows to the size of the message instead of a fixed 1 MiB buffer
+    std::vector<char> buf;
+    oscpack::write_message(buf, [&](oscpack::OutboundPacketStream& p) {
+      p << oscpack::BeginMessageN(address);
+      val.apply(osc_outbound_visitor{{p}});
+      p << oscpack::EndMessage();
+    });
+    ok = send(buf.data(), buf.size());
+  }
+
+  if (m_logger.outbound_logger && !m_logger.packet_log)
+    m_logger.outbound_logger->info("Out: {} {}", address, val);
+  return ok;
+}
+
+bool osc_tcp_protocol::send(const char* data, std::size_t sz)
+{
+  if (m_logger.packet_log)
+    m_logger.packet_log->log(packet_logger::outbound, data, sz);
+
+  bool sent = false;
+  {
+    ossia::lock_t lck{m_context->mutex};
+    for (auto& c : m_context->connections)
+      sent |= c->send(data, sz);
+  }
+
+  if (!sent)
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+  return sent;
+}
+
+void osc_tcp_protocol::set_device(device_base& dev)
+{
+  auto replace = [&] {
+    m_patterns.reset();
+    m_device = &dev;
+    m_patterns = std::make_unique<pattern_match_cache>(dev);
+  };
+
+  if (!m_context->thread.joinable())
+  {
+    // Nothing is connected nor received before there is a device
+    replace();
+    if (m_server)
+      accept();
+    else
+      connect();
+    m_context->thread = std::thread{[this] { m_context->io.run(); }};
+  }
+  else
+  {
+    // The received messages are handled on the io thread
+    std::promise<void> done;
+    asio::post(m_context->io, [&] {
+      replace();
+      done.set_value();
+    });
+    done.get_future().wait();
+  }
+}
+}
+}
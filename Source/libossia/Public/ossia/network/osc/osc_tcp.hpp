@@ -0,0 +1,131 @@
+#pragma once
+#include <ossia/detail/mutex.hpp>
+#include <ossia/detail/string_view.hpp>
+#include <ossia/network/base/listening.hpp>
+#include <ossia/network/base/protocol.hpp>
+#include <ossia/network/osc/detail/framing.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace oscpack
+{
+class OscPacketListener;
+}
+namespace ossia
+{
+namespace net
+{
+class bundle_encoder;
+class pattern_match_cache;
+
+/**
+ * @brief OSC over TCP
+ *
+ * Unlike osc_protocol, delivery is reliable and packets are not limited by
+ * the size of a datagram, which suits large lists and parameters which
+ * must not be lost.
+ *
+ * The protocol either connects to a remote server, and reconnects when the
+ * connection is lost, or accepts connections on a local port, in which
+ * case the values are sent to all the connected peers.
+ *
+ * Packets are delimited with the OSC 1.0 size prefix or OSC 1.1 SLIP
+ * framing. The messages sent while a write is in progress are queued and
+ * go out in a single write.
+ *
+ * The sockets are handled by a thread owned by the protocol, which starts
+ * connecting or accepting connections once the protocol has a device.
+ */
+class OSSIA_EXPORT osc_tcp_protocol final : public ossia::net::protocol_base
+{
+public:
+  //! Largest packet accepted from the peers
+  static constexpr std::size_t max_packet_size = 16 * 1024 * 1024;
+
+  //! Outbound bytes queued for a peer above which packets are dropped
+  static constexpr std::size_t max_queued_size = 16 * 1024 * 1024;
+
+  //! Connects to host:port
+  osc_tcp_protocol(
+      std::string host, uint16_t port,
+      osc_framing framing = osc_framing::slip);
+
+  //! Accepts connections on a local port
+  explicit osc_tcp_protocol(
+      uint16_t local_port, osc_framing framing = osc_framing::slip);
+
+  osc_tcp_protocol(const osc_tcp_protocol&) = delete;
+  osc_tcp_protocol(osc_tcp_protocol&&) = delete;
+  osc_tcp_protocol& operator=(const osc_tcp_protocol&) = delete;
+  osc_tcp_protocol& operator=(osc_tcp_protocol&&) = delete;
+
+  ~osc_tcp_protocol() override;
+
+  osc_framing get_framing() const;
+
+  //! Number of peers currently connected
+  std::size_t connections() const;
+
+  //! Packets which could not be sent: not connected, or too much data
+  //! queued for a peer
+  uint64_t dropped_outbound() const;
+
+  bool update(ossia::net::node_base& node_base) override;
+
+  bool pull(ossia::net::parameter_base& parameter_base) override;
+
+  bool push(
+      const ossia::net::parameter_base& parameter_base,
+      const ossia::value& v) override;
+  bool
+  push_raw(const ossia::net::full_parameter_data& parameter_base) override;
+  bool
+  push_bundle(const std::vector<const ossia::net::parameter_base*>&) override;
+  bool push_bundle_values(
+      const std::vector<std::pair<const parameter_base*, ossia::value>>&)
+      override;
+  bool push_encoded(encoded_message&) override;
+  bool push_raw_bundle(const std::vector<full_parameter_data>&) override;
+
+  bool
+  observe(ossia::net::parameter_base& parameter_base, bool enable) override;
+
+  void stop() override;
+
+private:
+  struct context;
+  struct connection;
+  struct receive_handler;
+
+  void set_device(ossia::net::device_base& dev) override;
+
+  void connect();
+  void reconnect_later();
+  void accept();
+  void add_connection(std::shared_ptr<connection> c);
+  void remove_connection(const connection& c);
+
+  bool send_message(ossia::string_view address, const ossia::value& val);
+  bool send(const char* data, std::size_t sz);
+
+  listened_parameters m_listening;
+  std::unique_ptr<pattern_match_cache> m_patterns;
+  std::unique_ptr<oscpack::OscPacketListener> m_listener;
+
+  std::unique_ptr<context> m_context;
+
+  ossia::mutex_t m_bundleMutex;
+  std::unique_ptr<bundle_encoder> m_bundle;
+
+  ossia::net::device_base* m_device{};
+  std::string m_host;
+  uint16_t m_port{};
+  osc_framing m_framing{};
+  bool m_server{};
+
+  std::atomic<uint64_t> m_dropped{};
+};
+}
+}
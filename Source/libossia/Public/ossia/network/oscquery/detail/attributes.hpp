@@ -110,6 +110,10 @@ constexpr auto attribute_critical()
 {
   return "CRITICAL";
 }
+constexpr auto attribute_deadband()
+{
+  return "DEADBAND";
+}
 constexpr auto attribute_hidden()
 {
   return "HIDDEN";
@@ -373,6 +377,14 @@ struct metadata<net::critical_attribute>
   }
 };
 template <>
+struct metadata<net::deadband_attribute>
+{
+  static constexpr auto key()
+  {
+    return detail::attribute_deadband();
+  }
+};
+template <>
 struct metadata<net::hidden_attribute>
 {
   static constexpr auto key()
@@ -451,7 +463,8 @@ using base_attributes_without_type = brigand::list<
 using extended_attributes = brigand::list<
     net::tags_attribute, net::refresh_rate_attribute, net::priority_attribute,
     net::value_step_size_attribute, net::instance_bounds_attribute,
-    net::critical_attribute, net::hidden_attribute, net::disabled_attribute,
+    net::critical_attribute, net::deadband_attribute, net::hidden_attribute,
+    net::disabled_attribute,
     net::extended_type_attribute, net::description_attribute,
     net::app_name_attribute, net::app_creator_attribute,
     net::app_version_attribute>;
@@ -461,7 +474,8 @@ using attributes_when_reading = brigand::list<
     net::bounding_mode_attribute, net::repetition_filter_attribute,
     net::tags_attribute, net::refresh_rate_attribute, net::priority_attribute,
     net::value_step_size_attribute, net::instance_bounds_attribute,
-    net::critical_attribute, net::hidden_attribute, net::disabled_attribute,
+    net::critical_attribute, net::deadband_attribute, net::hidden_attribute,
+    net::disabled_attribute,
     net::description_attribute, net::app_name_attribute,
     net::app_creator_attribute, net::app_version_attribute>;
 
@@ -474,7 +488,8 @@ using all_attributes = brigand::list<
     net::bounding_mode_attribute, net::repetition_filter_attribute,
     net::tags_attribute, net::refresh_rate_attribute, net::priority_attribute,
     net::value_step_size_attribute, net::instance_bounds_attribute,
-    net::critical_attribute, net::hidden_attribute, net::disabled_attribute,
+    net::critical_attribute, net::deadband_attribute, net::hidden_attribute,
+    net::disabled_attribute,
     net::description_attribute, net::app_name_attribute,
     net::app_creator_attribute, net::app_version_attribute>;
 }
@@ -416,6 +416,26 @@ bool json_parser_impl::ReadValue(
   return b;
 }
 
+bool json_parser_impl::ReadValue(
+    const rapidjson::Value& val, ossia::deadband& res)
+{
+  bool b = val.IsArray();
+  if (b)
+  {
+    auto arr = val.GetArray();
+    if (arr.Size() == 2 && arr[0].IsNumber() && arr[1].IsNumber())
+    {
+      res.absolute = arr[0].GetDouble();
+      res.relative = arr[1].GetDouble();
+    }
+    else
+    {
+      b = false;
+    }
+  }
+  return b;
+}
+
 using map_setter_fun
     = void (*)(const rapidjson::Value&, ossia::net::node_base&);
 template <typename Attr>
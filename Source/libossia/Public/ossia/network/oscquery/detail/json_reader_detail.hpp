@@ -35,6 +35,7 @@ struct json_parser_impl
   static bool ReadValue(const rapidjson::Value& val, ossia::net::tags& res);
   static bool
   ReadValue(const rapidjson::Value& val, ossia::net::instance_bounds& res);
+  static bool ReadValue(const rapidjson::Value& val, ossia::deadband& res);
 
   static ossia::value ReadValue(const rapidjson::Value& val);
 
@@ -134,6 +134,14 @@ void json_writer_impl::writeValue(const net::instance_bounds& i) const
   writer.EndArray();
 }
 
+void json_writer_impl::writeValue(const ossia::deadband& i) const
+{
+  writer.StartArray();
+  writer.Double(i.absolute);
+  writer.Double(i.relative);
+  writer.EndArray();
+}
+
 using writer_map_fun
     = void (*)(const json_writer_impl&, const ossia::net::node_base&);
 using writer_map_type = string_view_map<writer_map_fun>;
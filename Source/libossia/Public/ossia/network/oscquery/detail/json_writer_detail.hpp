@@ -28,6 +28,7 @@ struct json_writer_impl
   void writeValue(const std::string& i) const;
   void writeValue(const ossia::repetition_filter& i) const;
   void writeValue(const ossia::net::instance_bounds& i) const;
+  void writeValue(const ossia::deadband& i) const;
 
   template <typename T, typename... Args>
   void writeValue(const std::optional<T>& t, Args&&... args) const
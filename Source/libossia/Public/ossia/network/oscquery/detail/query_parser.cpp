@@ -198,6 +198,29 @@ void query_parser::parse(
   }
 }
 
+void query_parser::parse(
+    net::deadband_attribute attr, const std::string& data,
+    net::parameter_data& res)
+{
+  // [absolute,relative], or only the absolute threshold
+  try
+  {
+    ossia::string_view str = data;
+    if (str.size() >= 2 && str.front() == '[' && str.back() == ']')
+      str = str.substr(1, str.size() - 2);
+
+    ossia::deadband d;
+    auto comma = str.find(',');
+    d.absolute = boost::lexical_cast<double>(std::string(str.substr(0, comma)));
+    if (comma != ossia::string_view::npos)
+      d.relative = boost::lexical_cast<double>(std::string(str.substr(comma + 1)));
+    attr.setter(res, d);
+  }
+  catch (...)
+  {
+  }
+}
+
 void query_parser::parse(
     net::hidden_attribute attr, const std::string& data,
     net::parameter_data& res)
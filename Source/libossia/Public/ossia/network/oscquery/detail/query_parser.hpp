@@ -69,6 +69,9 @@ public:
   static void parse(
       net::critical_attribute attr, const std::string& data,
       net::parameter_data& res);
+  static void parse(
+      net::deadband_attribute attr, const std::string& data,
+      net::parameter_data& res);
   static void parse(
       net::hidden_attribute attr, const std::string& data,
       net::parameter_data& res);
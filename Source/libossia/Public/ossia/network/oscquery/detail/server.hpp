@@ -3,6 +3,7 @@
 
 #include <ossia/detail/json.hpp>
 #include <ossia/detail/logger.hpp>
+#include <ossia/detail/string_view.hpp>
 #include <ossia/network/exceptions.hpp>
 #include <ossia/network/oscquery/detail/server_reply.hpp>
 
@@ -218,7 +219,7 @@ public:
         websocketpp::frame::opcode::text);
   }
 
-  void send_binary_message(connection_handler hdl, const std::string& message)
+  void send_binary_message(connection_handler hdl, ossia::string_view message)
   {
     auto con = m_server.get_con_from_hdl(hdl);
     con->send(
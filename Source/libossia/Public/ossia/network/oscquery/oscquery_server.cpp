@@ -6,6 +6,7 @@
 #include <ossia/detail/string_map.hpp>
 #include <ossia/network/common/network_logger.hpp>
 #include <ossia/network/common/node_visitor.hpp>
+#include <ossia/network/dataspace/dataspace_variant_visitors.hpp>
 #include <ossia/network/generic/generic_device.hpp>
 #include <ossia/network/generic/generic_node.hpp>
 #include <ossia/network/generic/generic_parameter.hpp>
@@ -75,6 +76,8 @@ oscquery_server_protocol::~oscquery_server_protocol()
         this);
     dev.on_node_removing.disconnect<&oscquery_server_protocol::on_nodeRemoved>(
         this);
+    dev.on_nodes_learned
+        .disconnect<&oscquery_server_protocol::on_nodesLearned>(this);
     dev.on_parameter_created
         .disconnect<&oscquery_server_protocol::on_parameterChanged>(this);
     dev.on_parameter_removing
@@ -150,6 +153,62 @@ bool oscquery_server_protocol::push(const net::parameter_base& addr, const ossia
   return push_impl(addr, v);
 }
 
+bool oscquery_server_protocol::push_encoded(net::encoded_message& msg)
+{
+  const auto& addr = msg.parameter;
+  const auto& val = msg.filtered();
+  if (!val.valid())
+    return false;
+
+  // Same message as osc_writer::send_message, encoded once for all the
+  // clients
+  auto packet = msg.get(
+      net::encoded_message::oscquery_osc,
+      [&](net::encoded_message::buffer& buf) {
+        oscpack::write_message(buf, [&](oscpack::OutboundPacketStream& p) {
+          p << oscpack::BeginMessageN(addr.get_node().osc_address());
+          if (const auto& u = addr.get_unit())
+          {
+            ossia::apply_nonnull(
+                [&](const auto& dataspace) {
+                  ossia::apply(osc_outbound_visitor{p}, val.v, dataspace);
+                },
+                u.v);
+          }
+          else
+          {
+            val.apply(osc_outbound_visitor{p});
+          }
+          p << oscpack::EndMessage();
+        });
+      });
+
+  if (m_logger.outbound_logger)
+    m_logger.outbound_logger->info(
+        "Out: {} {}", addr.get_node().osc_address(), val);
+
+  const bool critical = addr.get_critical();
+  lock_t lock(m_clientsMutex);
+  for (auto& client : m_clients)
+  {
+    if (!critical && client.sender)
+    {
+      try
+      {
+        client.sender->socket().Send(packet.data(), packet.size());
+      }
+      catch (...)
+      {
+      }
+    }
+    else
+    {
+      m_websocketServer->send_binary_message(client.connection, packet);
+    }
+  }
+  return true;
+}
+
 bool oscquery_server_protocol::push_raw(const net::full_parameter_data& addr)
 {
   return push_impl(addr, addr.value());
@@ -260,6 +319,8 @@ void oscquery_server_protocol::set_device(net::device_base& dev)
         .disconnect<&oscquery_server_protocol::on_nodeCreated>(this);
     old.on_node_removing
         .disconnect<&oscquery_server_protocol::on_nodeRemoved>(this);
+    old.on_nodes_learned
+        .disconnect<&oscquery_server_protocol::on_nodesLearned>(this);
     dev.on_parameter_created
         .disconnect<&oscquery_server_protocol::on_parameterChanged>(this);
     dev.on_parameter_removing
@@ -282,6 +343,8 @@ void oscquery_server_protocol::set_device(net::device_base& dev)
       .connect<&oscquery_server_protocol::on_nodeCreated>(this);
   dev.on_node_removing
       .connect<&oscquery_server_protocol::on_nodeRemoved>(this);
+  dev.on_nodes_learned
+      .connect<&oscquery_server_protocol::on_nodesLearned>(this);
   dev.on_parameter_created
       .connect<&oscquery_server_protocol::on_parameterChanged>(this);
   dev.on_parameter_removing
@@ -564,6 +627,14 @@ catch (...)
   logger().error("oscquery_server_protocol::on_nodeRemoved: error.");
 }
 
+void oscquery_server_protocol::on_nodesLearned(
+    const std::vector<net::node_base*>& nodes)
+{
+  // Learned nodes are not signalled one by one
+  for (auto n : nodes)
+    on_nodeCreated(*n);
+}
+
 void oscquery_server_protocol::on_parameterChanged(const ossia::net::parameter_base& p)
 {
   on_attributeChanged(p.get_node(), ossia::net::text_value_type());
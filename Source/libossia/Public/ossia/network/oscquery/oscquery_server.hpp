@@ -60,6 +60,7 @@ public:
   void request(net::parameter_base&) override;
   bool push(const net::parameter_base&, const ossia::value& v) override;
   bool push_raw(const ossia::net::full_parameter_data& parameter_base) override;
+  bool push_encoded(ossia::net::encoded_message&) override;
   bool
   push_bundle(const std::vector<const ossia::net::parameter_base*>&) override;
   bool push_raw_bundle(
@@ -103,6 +104,7 @@ private:
   // Local device callback
   void on_nodeCreated(const ossia::net::node_base&);
   void on_nodeRemoved(const ossia::net::node_base&);
+  void on_nodesLearned(const std::vector<ossia::net::node_base*>&);
   void on_parameterChanged(const ossia::net::parameter_base&);
   void
   on_attributeChanged(const ossia::net::node_base&, ossia::string_view attr);
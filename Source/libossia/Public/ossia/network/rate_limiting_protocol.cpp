@@ -1,84 +1,196 @@
 // This is an open source non-commercial project. Dear PVS-Studio, please check
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <ossia/detail/algorithms.hpp>
+#include <ossia/network/exceptions.hpp>
 #include <ossia/network/generic/generic_device.hpp>
 #include <ossia/network/generic/generic_parameter.hpp>
 #include <ossia/network/rate_limiting_protocol.hpp>
 
 namespace ossia::net
 {
+namespace
+{
+// Resolution of the scheduling of the slots
+constexpr auto tick = std::chrono::milliseconds(1);
+
+// Period of the slots not covered by a rate policy
+constexpr int64_t default_period = -1;
+}
+
+struct rate_limiting_protocol::slot
+{
+  struct value_box
+  {
+    ossia::value value;
+  };
+
+  explicit slot(const ossia::net::parameter_base* p) noexcept : parameter{p}
+  {
+  }
+
+  ~slot()
+  {
+    delete latest.load();
+    delete spare.load();
+  }
+
+  // Changes when a retired slot is reused for another parameter : lookups
+  // which still see the slot compare against the new one.
+  std::atomic<const ossia::net::parameter_base*> parameter{};
+
+  // Last pushed value not sent yet, and a box kept to be reused so that
+  // pushing scalar values does not allocate.
+  // Boxes are only accessed by the thread which took them out of the slot
+  // with an exchange.
+  std::atomic<value_box*> latest{};
+  std::atomic<value_box*> spare{};
+
+  // Set from the first push of a value until it is sent, i.e. while the
+  // slot is in the dirty queue or in the timer wheel
+  std::atomic_bool dirty{};
+
+  // In nanoseconds, or default_period
+  std::atomic<int64_t> period{default_period};
+
+  // Earliest date at which the next value can be sent. Only used by the
+  // flush thread.
+  rate_limiting_protocol::clock::time_point next_allowed{};
+
+  // Cleared when the parameter is removed
+  std::atomic_bool active{true};
+
+  // Set once the slot has left the table and can be reused. Guarded by
+  // m_slotMutex.
+  bool retired{};
+
+  std::atomic<slot*> next{};
+};
+
+/**
+ * Open-addressing table of the slots, keyed by parameter.
+ * Entries are changed by one thread at a time, and lookups do not need
+ * locking. A lookup which misses a slot being moved falls back to the
+ * locked path of get_slot. Removed entries are replaced by a tombstone,
+ * which insertions reuse.
+ */
+struct rate_limiting_protocol::slot_table
+{
+  explicit slot_table(std::size_t capacity)
+      : entries{std::make_unique<std::atomic<slot*>[]>(capacity)}
+      , mask{capacity - 1}
+  {
+  }
+
+  static std::size_t hash(const ossia::net::parameter_base* p) noexcept
+  {
+    // Fibonacci hashing of the address, without the alignment bits
+    return (std::size_t(p) >> 4) * std::size_t(11400714819323198485ull);
+  }
+
+  static slot* tombstone() noexcept
+  {
+    static slot s{nullptr};
+    return &s;
+  }
+
+  slot* find(const ossia::net::parameter_base* p) const noexcept
+  {
+    for (std::size_t i = hash(p) & mask;; i = (i + 1) & mask)
+    {
+      slot* s = entries[i].load(std::memory_order_acquire);
+      if (!s || s->parameter.load(std::memory_order_acquire) == p)
+        return s;
+    }
+  }
+
+  void insert(slot* s) noexcept
+  {
+    std::size_t i = hash(s->parameter.load(std::memory_order_relaxed)) & mask;
+    for (;; i = (i + 1) & mask)
+    {
+      slot* e = entries[i].load(std::memory_order_relaxed);
+      if (!e)
+      {
+        count++;
+        break;
+      }
+      if (e == tombstone())
+      {
+        tombstones--;
+        break;
+      }
+    }
+    entries[i].store(s, std::memory_order_release);
+  }
+
+  void erase(slot* s) noexcept
+  {
+    const auto p = s->parameter.load(std::memory_order_relaxed);
+    for (std::size_t i = hash(p) & mask;; i = (i + 1) & mask)
+    {
+      slot* e = entries[i].load(std::memory_order_relaxed);
+      if (!e)
+        return;
+      if (e == s)
+      {
+        entries[i].store(tombstone(), std::memory_order_release);
+        tombstones++;
+        return;
+      }
+    }
+  }
+
+  //! Removes the tombstones by inserting the slots again
+  template <typename Slots>
+  void rehash(const Slots& slots) noexcept
+  {
+    for (std::size_t i = 0; i <= mask; i++)
+      entries[i].store(nullptr, std::memory_order_relaxed);
+    count = 0;
+    tombstones = 0;
+    for (auto& s : slots)
+      if (!s->retired)
+        insert(s.get());
+  }
+
+  bool full() const noexcept
+  {
+    // Keep the probe sequences short
+    return 2 * (count + 1) > mask + 1;
+  }
+
+  //! Whether the live slots would still fill more than a quarter of the
+  //! table once the tombstones are removed
+  bool crowded() const noexcept
+  {
+    return 4 * (count - tombstones + 1) > mask + 1;
+  }
+
+  std::unique_ptr<std::atomic<slot*>[]> entries;
+  std::size_t mask{};
+  std::size_t count{}; // Live entries and tombstones
+  std::size_t tombstones{};
+};
+
 struct rate_limiter
 {
   rate_limiting_protocol& self;
   void operator()() const noexcept {
     using namespace std::literals;
     using clock = rate_limiting_protocol::clock;
-    const auto duration = self.m_duration.load();
-    thread_local auto time_to_sleep = duration;
+    auto next_tick = clock::now();
     while(self.m_running)
     {
       try {
-        auto prev_time = clock::now();
-        if(time_to_sleep > 1ms)
-          std::this_thread::sleep_for(time_to_sleep);
-
-        // TODO find safe way to handle if a parameter is removed
-        // TODO instead we should do the value filtering in the parameter ...
-        // but still have to handle cases that can be optimized, such as midi
-        {
-          std::lock_guard lock{self.m_msgMutex};
-          std::swap(self.m_buffer, self.m_userMessages);
-        }
-
-        // Copy newest messages in local map
-        for(auto& msg : self.m_buffer.container)
-        {
-          if(msg.second.first.valid())
-          {
-            self.m_threadMessages[msg.first] = std::move(msg.second);
-            msg.second.first = ossia::value{};
-          }
-        }
-
-        // Push the actual messages
-        for(auto& v : self.m_threadMessages.container)
-        {
-          auto val = v.second.first;
-          if(val.valid())
-          {
-            self.m_protocol->push(*v.first, v.second.first);
-          }
-        }
+        next_tick += tick;
+        std::this_thread::sleep_until(next_tick);
 
-        // Clear both containers (while keeping memory allocated for sent messages
-        // so that it stays fast)
-        for(auto& v : self.m_buffer.container)
-        {
-          if(v.second.first.valid())
-          {
-            v.second.first = ossia::value{};
-          }
-        }
+        // Do not try to catch up after a long stall
+        const auto now = clock::now();
+        if(now - next_tick > 100ms)
+          next_tick = now;
 
-        for(auto& v : self.m_threadMessages.container)
-        {
-          if(v.second.first.valid())
-          {
-            v.second.first = ossia::value{};
-          }
-        }
-        auto new_time = clock::now();
-        auto observed_duration = std::chrono::duration_cast<std::chrono::milliseconds>(new_time - prev_time);
-        if(observed_duration > duration)
-        {
-          if(observed_duration >= 2 * duration)
-            time_to_sleep = 0ms;
-          else
-            time_to_sleep = 2 * duration - observed_duration ;
-        }
-        else
-        {
-          time_to_sleep = duration;
-        }
+        self.flush(now);
       } catch(...) {
 
       }
@@ -91,12 +203,15 @@ rate_limiting_protocol::rate_limiting_protocol(
     , std::unique_ptr<protocol_base> arg)
   : m_duration{d}
   , m_protocol{std::move(arg)}
-
+  , m_stub{std::make_unique<slot>(nullptr)}
+  , m_dirtyHead{m_stub.get()}
+  , m_dirtyTail{m_stub.get()}
 {
-  m_userMessages.container.reserve(4096);
-  m_buffer.container.reserve(4096);
-  m_threadMessages.container.reserve(4096);
-  m_lastTime = clock::now();
+  m_start = clock::now();
+  m_tables.push_back(std::make_unique<slot_table>(4096));
+  m_table = m_tables.back().get();
+  m_slots.reserve(2048);
+  m_values.reserve(2048);
   m_thread = std::thread{rate_limiter{*this}};
 }
 
@@ -104,6 +219,10 @@ rate_limiting_protocol::~rate_limiting_protocol()
 {
   m_running = false;
   m_thread.join();
+
+  if (m_device)
+    m_device->on_parameter_removing
+        .disconnect<&rate_limiting_protocol::parameter_removed>(this);
 }
 
 void rate_limiting_protocol::set_duration(rate_limiting_protocol::duration d)
@@ -116,10 +235,105 @@ bool rate_limiting_protocol::pull(ossia::net::parameter_base& address)
   return m_protocol->pull(address);
 }
 
+void rate_limiting_protocol::set_rate_policy(std::string address, duration period)
+{
+  std::optional<ossia::traversal::path> pattern;
+  if (ossia::traversal::is_pattern(address))
+  {
+    pattern = ossia::traversal::make_path(address);
+    if (!pattern)
+      throw ossia::parse_error{"rate_limiting_protocol: invalid pattern: " + address};
+  }
+  else if (address.size() > 1 && address.back() == '/')
+  {
+    address.pop_back();
+  }
+
+  std::lock_guard flush_lock{m_flushMutex};
+  std::lock_guard lock{m_slotMutex};
+  ossia::remove_erase_if(m_policies, [&](const rate_policy& p) { return p.address == address; });
+  m_policies.push_back({std::move(address), std::move(pattern), period});
+  update_policies();
+}
+
+void rate_limiting_protocol::remove_rate_policy(ossia::string_view address)
+{
+  if (address.size() > 1 && address.back() == '/')
+    address.remove_suffix(1);
+
+  std::lock_guard flush_lock{m_flushMutex};
+  std::lock_guard lock{m_slotMutex};
+  ossia::remove_erase_if(m_policies, [&](const rate_policy& p) { return p.address == address; });
+  update_policies();
+}
+
+int64_t rate_limiting_protocol::policy_period(const parameter_base& addr) const
+{
+  if (m_policies.empty())
+    return default_period;
+
+  auto& node = addr.get_node();
+  const auto address = node.osc_address();
+  for (auto it = m_policies.rbegin(); it != m_policies.rend(); ++it)
+  {
+    bool matches = false;
+    if (it->pattern)
+    {
+      matches = ossia::traversal::match(*it->pattern, node);
+    }
+    else
+    {
+      const auto& root = it->address;
+      matches = root == "/"
+                || (address.compare(0, root.size(), root) == 0
+                    && (address.size() == root.size() || address[root.size()] == '/'));
+    }
+
+    if (matches)
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(it->period).count();
+  }
+  return default_period;
+}
+
+void rate_limiting_protocol::update_policies()
+{
+  // The parameters of the inactive slots may not exist anymore
+  for (auto& s : m_slots)
+    if (s->active.load(std::memory_order_relaxed))
+      s->period.store(
+          policy_period(*s->parameter.load(std::memory_order_relaxed)),
+          std::memory_order_relaxed);
+}
+
+rate_limiting_protocol::duration
+rate_limiting_protocol::period(const slot& s) const noexcept
+{
+  const auto p = s.period.load(std::memory_order_relaxed);
+  if (p == default_period)
+    return m_duration.load();
+  return std::chrono::duration_cast<duration>(std::chrono::nanoseconds(p));
+}
+
 bool rate_limiting_protocol::push(const ossia::net::parameter_base& address, const ossia::value& v)
 {
-  std::lock_guard lock{m_msgMutex};
-  m_userMessages[&address] = {v, {}};
+  if (address.get_critical())
+    return m_protocol->push(address, v);
+
+  auto& s = get_slot(address);
+  if (s.period.load(std::memory_order_relaxed) == 0)
+    return m_protocol->push(address, v);
+
+  auto box = s.spare.exchange(nullptr, std::memory_order_acquire);
+  if (!box)
+    box = new slot::value_box;
+  box->value = v;
+
+  // The previous value was not sent yet: keep its box for the next push
+  if (auto old = s.latest.exchange(box, std::memory_order_acq_rel))
+    delete s.spare.exchange(old, std::memory_order_acq_rel);
+
+  if (!s.dirty.exchange(true, std::memory_order_seq_cst))
+    enqueue_dirty(s);
   return true;
 }
 
@@ -156,8 +370,196 @@ void rate_limiting_protocol::stop()
 
 void rate_limiting_protocol::set_device(device_base& dev)
 {
+  if (m_device)
+    m_device->on_parameter_removing
+        .disconnect<&rate_limiting_protocol::parameter_removed>(this);
+
   m_device = &dev;
+  m_device->on_parameter_removing
+      .connect<&rate_limiting_protocol::parameter_removed>(this);
   m_protocol->set_device(dev);
 }
 
+void rate_limiting_protocol::parameter_removed(const parameter_base& b)
+{
+  std::lock_guard lock{m_flushMutex};
+  if (auto s = find_slot(b); s && s->active.load(std::memory_order_relaxed))
+  {
+    s->active.store(false, std::memory_order_relaxed);
+    delete s->latest.exchange(nullptr, std::memory_order_acq_rel);
+
+    // A dirty slot is retired by flush() when it leaves the wheel
+    if (!s->dirty.load(std::memory_order_seq_cst))
+      retire(*s);
+  }
+}
+
+void rate_limiting_protocol::retire(slot& s)
+{
+  // Called with m_flushMutex locked. The slot object is not freed, since
+  // lookups without locking may still be reading it: it is reused by the
+  // next parameter pushed for the first time.
+  std::lock_guard lock{m_slotMutex};
+  m_table.load(std::memory_order_relaxed)->erase(&s);
+  s.retired = true;
+  m_freeSlots.push_back(&s);
+}
+
+rate_limiting_protocol::slot*
+rate_limiting_protocol::find_slot(const parameter_base& addr) const noexcept
+{
+  return m_table.load(std::memory_order_acquire)->find(&addr);
+}
+
+rate_limiting_protocol::slot&
+rate_limiting_protocol::get_slot(const parameter_base& addr)
+{
+  if (auto s = find_slot(addr); s && s->active.load(std::memory_order_relaxed))
+    return *s;
+
+  // First push of this parameter
+  std::lock_guard lock{m_slotMutex};
+  auto table = m_table.load(std::memory_order_relaxed);
+  if (auto s = table->find(&addr))
+  {
+    // A new parameter at the address of a removed one
+    s->period.store(policy_period(addr), std::memory_order_relaxed);
+    s->active.store(true, std::memory_order_relaxed);
+    return *s;
+  }
+
+  if (table->full())
+  {
+    if (table->crowded())
+    {
+      // Readers may still be looking in the previous table, which is kept.
+      auto bigger = std::make_unique<slot_table>(2 * (table->mask + 1));
+      for (auto& s : m_slots)
+        if (!s->retired)
+          bigger->insert(s.get());
+      table = bigger.get();
+      m_tables.push_back(std::move(bigger));
+      m_table.store(table, std::memory_order_release);
+    }
+    else
+    {
+      // Mostly tombstones of removed parameters
+      table->rehash(m_slots);
+    }
+  }
+
+  slot* s{};
+  if (!m_freeSlots.empty())
+  {
+    s = m_freeSlots.back();
+    m_freeSlots.pop_back();
+    s->retired = false;
+    s->next_allowed = {};
+    s->active.store(true, std::memory_order_relaxed);
+    s->parameter.store(&addr, std::memory_order_release);
+  }
+  else
+  {
+    m_slots.push_back(std::make_unique<slot>(&addr));
+    s = m_slots.back().get();
+  }
+  s->period.store(policy_period(addr), std::memory_order_relaxed);
+  table->insert(s);
+  return *s;
+}
+
+void rate_limiting_protocol::enqueue_dirty(slot& s) noexcept
+{
+  // Wait-free push, see
+  // http://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+  s.next.store(nullptr, std::memory_order_relaxed);
+  auto prev = m_dirtyHead.exchange(&s, std::memory_order_acq_rel);
+  prev->next.store(&s, std::memory_order_release);
+}
+
+rate_limiting_protocol::slot* rate_limiting_protocol::dequeue_dirty() noexcept
+{
+  auto tail = m_dirtyTail;
+  auto next = tail->next.load(std::memory_order_acquire);
+  if (tail == m_stub.get())
+  {
+    if (!next)
+      return nullptr;
+    m_dirtyTail = next;
+    tail = next;
+    next = next->next.load(std::memory_order_acquire);
+  }
+
+  if (next)
+  {
+    m_dirtyTail = next;
+    return tail;
+  }
+
+  // A push is in progress: the slot will be handled by the next flush
+  if (tail != m_dirtyHead.load(std::memory_order_acquire))
+    return nullptr;
+
+  enqueue_dirty(*m_stub);
+  next = tail->next.load(std::memory_order_acquire);
+  if (next)
+  {
+    m_dirtyTail = next;
+    return tail;
+  }
+  return nullptr;
+}
+
+void rate_limiting_protocol::flush(clock::time_point now)
+{
+  auto to_tick = [this](clock::time_point t) {
+    // Rounded up: values are never sent before their date
+    return std::chrono::ceil<std::chrono::milliseconds>(t - m_start).count();
+  };
+
+  std::lock_guard lock{m_flushMutex};
+  while (auto s = dequeue_dirty())
+    m_wheel.insert(to_tick(std::max(now, s->next_allowed)), s);
+
+  m_wheel.advance(
+      std::chrono::floor<std::chrono::milliseconds>(now - m_start).count(),
+      [&](auto, slot* s) {
+        // Cleared before taking the value: a concurrent push either gets
+        // its value taken now, or queues the slot again.
+        s->dirty.store(false, std::memory_order_seq_cst);
+        if (!s->active.load(std::memory_order_relaxed))
+        {
+          // The parameter was removed while the slot was dirty
+          retire(*s);
+          return;
+        }
+
+        auto box = s->latest.exchange(nullptr, std::memory_order_acq_rel);
+        if (!box)
+          return;
+
+        m_values.emplace_back(
+            s->parameter.load(std::memory_order_relaxed),
+            std::move(box->value));
+
+        // Keeps the cadence when the slot is sent late by at most a tick,
+        // e.g. because of the rounding to the wheel resolution. A slot idle
+        // for longer starts a new period now: the next value must not be
+        // sent earlier than a period after this one.
+        const auto p = period(*s);
+        if (now - s->next_allowed > tick)
+          s->next_allowed = now + p;
+        else
+          s->next_allowed += p;
+
+        delete s->spare.exchange(box, std::memory_order_acq_rel);
+      });
+
+  if (!m_values.empty())
+  {
+    m_protocol->push_bundle_values(m_values);
+    m_values.clear();
+  }
+}
+
 }
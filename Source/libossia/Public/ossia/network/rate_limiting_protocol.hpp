@@ -1,17 +1,41 @@
 #pragma once
 #include <ossia/network/base/protocol.hpp>
 #include <ossia/network/base/parameter_data.hpp>
-#include <ossia/network/base/message_queue.hpp>
-#include <ossia/detail/flat_map.hpp>
-#include <ossia/detail/algorithms.hpp>
-#include <readerwriterqueue.h>
+#include <ossia/network/value/value.hpp>
+#include <ossia/detail/mutex.hpp>
+#include <ossia/detail/optional.hpp>
+#include <ossia/detail/string_view.hpp>
+#include <ossia/detail/timer_wheel.hpp>
+#include <ossia/network/common/path.hpp>
+#include <atomic>
 #include <chrono>
+#include <memory>
+#include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 namespace ossia::net
 {
 struct rate_limiter;
+
+/**
+ * @brief Limits the rate at which another protocol sends values
+ *
+ * push() stores the value in a slot dedicated to the parameter and marks
+ * the slot as dirty, without locking: the slots of the parameters already
+ * pushed are found in a lock-free hash table, and dirty slots are appended
+ * to a wait-free queue. Only the first push of a parameter takes a lock.
+ *
+ * Each parameter is sent at most once per period: the period given to the
+ * constructor, or the one of the rate policy covering the parameter.
+ * A thread schedules the dirty slots in a timer wheel, at the earliest date
+ * their parameter can be sent again, and sends the latest value of the
+ * slots which are due in one push_bundle_values call to the wrapped
+ * protocol, with a 1 ms resolution.
+ *
+ * Critical parameters are never limited.
+ */
 class OSSIA_EXPORT rate_limiting_protocol final
     : public ossia::net::protocol_base
 {
@@ -21,9 +45,34 @@ public:
   rate_limiting_protocol(duration d, std::unique_ptr<protocol_base> arg);
   ~rate_limiting_protocol() override;
 
+  //! Period of the parameters which are not covered by a rate policy
   void set_duration(duration d);
 
+  /**
+   * @brief Sets the period of the parameters under an address
+   *
+   * The address is either a node, in which case the policy applies to its
+   * whole subtree, or an OSC pattern, e.g. "/tracker[0-9]/position", which
+   * applies to the matching parameters.
+   * When several policies apply to a parameter, the last one set wins.
+   *
+   * A zero period disables rate limiting : values are pushed immediately.
+   *
+   * @throws ossia::parse_error if the pattern is invalid.
+   */
+  void set_rate_policy(std::string address, duration period);
+  void remove_rate_policy(ossia::string_view address);
+
 private:
+  struct slot;
+  struct slot_table;
+  struct rate_policy
+  {
+    std::string address;
+    std::optional<ossia::traversal::path> pattern;
+    duration period{};
+  };
+
   bool pull(ossia::net::parameter_base&) override;
   bool push(const ossia::net::parameter_base& addr, const ossia::value& v) override;
   bool push_raw(const full_parameter_data&) override;
@@ -37,6 +86,16 @@ private:
   void set_device(ossia::net::device_base& dev) override;
 
   void parameter_removed(const ossia::net::parameter_base& b);
+  void retire(slot& s);
+
+  slot* find_slot(const ossia::net::parameter_base& addr) const noexcept;
+  slot& get_slot(const ossia::net::parameter_base& addr);
+  int64_t policy_period(const ossia::net::parameter_base& addr) const;
+  void update_policies();
+  duration period(const slot& s) const noexcept;
+  void enqueue_dirty(slot& s) noexcept;
+  slot* dequeue_dirty() noexcept;
+  void flush(clock::time_point now);
 
   rate_limiting_protocol() = delete;
   rate_limiting_protocol(const rate_limiting_protocol&) = delete;
@@ -53,12 +112,30 @@ private:
   std::atomic_bool m_running{true};
   std::thread m_thread;
 
-  clock::time_point m_lastTime;
-  using map_t = ossia::flat_map<const ossia::net::parameter_base*, std::pair<ossia::value, clock::time_point>>;
-  map_t m_userMessages;
-  map_t m_buffer;
-  map_t m_threadMessages;
-  std::mutex m_msgMutex;
+  // Slots, by parameter. Previous tables are kept alive as long as the
+  // protocol since push() may still be reading them.
+  // The slots of removed parameters are retired in m_freeSlots, and reused.
+  std::atomic<slot_table*> m_table{};
+  std::vector<std::unique_ptr<slot_table>> m_tables;
+  std::vector<std::unique_ptr<slot>> m_slots;
+  std::vector<slot*> m_freeSlots;
+  ossia::mutex_t m_slotMutex;
+
+  // Intrusive multiple-producer queue of the dirty slots
+  std::unique_ptr<slot> m_stub;
+  alignas(64) std::atomic<slot*> m_dirtyHead{};
+  alignas(64) slot* m_dirtyTail{};
+
+  std::vector<rate_policy> m_policies;
+
+  // Dirty slots waiting until their parameter can be sent again
+  clock::time_point m_start;
+  ossia::timer_wheel<slot*> m_wheel;
+
+  // Held while sending, so that parameters are not removed meanwhile
+  ossia::mutex_t m_flushMutex;
+  std::vector<std::pair<const ossia::net::parameter_base*, ossia::value>>
+      m_values;
 };
 
 template<typename Protocol, typename... Args>
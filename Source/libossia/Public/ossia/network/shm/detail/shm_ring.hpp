@@ -0,0 +1,333 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstring>
+
+namespace ossia
+{
+namespace net
+{
+/**
+ * @brief Lock-free byte ring laid out in a shared memory segment
+ *
+ * Any number of processes can write packets in the ring, which is read by a
+ * single process, the owner of the segment.
+ *
+ * Writers reserve space by advancing the write position with a CAS, copy
+ * the packet, then publish its size in the 4-byte record header. The reader
+ * waits for the header of the next record to be published, reads the
+ * packet, and clears the record before releasing the space, so that
+ * headers of records which are not published yet always read as zero.
+ * While the packet is copied, the header holds its size with the pending
+ * bit set.
+ *
+ * A writer which dies between reserving and publishing its record would
+ * block the ring forever. But a writer which is only slow, e.g. paused in a
+ * debugger, may still write in its record at any time: the space of a
+ * record is never released before it is published. Instead, a record which
+ * stays unpublished longer than stall_timeout, or a header which is not
+ * consistent with the write position, marks the ring as broken: the reader
+ * then closes it and reads from a new segment, and the writers open the new
+ * segment once they see that the ring is closed.
+ *
+ * The ring does not sleep by itself : write() tells whether the reader has
+ * to be woken up, and the reader announces with prepare_wait() that it is
+ * going to sleep on the wait_word() futex, or equivalent.
+ */
+class shm_ring
+{
+public:
+  static constexpr uint32_t magic = 0x6f73686d; // "oshm"
+  static constexpr uint32_t version = 2;
+
+  //! Set in the size of a record which is being written
+  static constexpr uint32_t pending = 0x80000000;
+
+  //! Delay after which an unpublished record is considered abandoned
+  static constexpr std::chrono::seconds stall_timeout{1};
+
+  struct header
+  {
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint64_t capacity;
+    //! Identifier of the process reading the ring
+    uint32_t owner;
+
+    alignas(64) std::atomic<uint64_t> write_pos;
+    alignas(64) std::atomic<uint64_t> read_pos;
+
+    // Incremented after each write; the reader sleeps on it.
+    alignas(64) std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> waiting;
+  };
+
+  static constexpr std::size_t data_offset = (sizeof(header) + 63) / 64 * 64;
+
+  //! Size of the segment needed for a ring of the given capacity, which
+  //! must be a power of two.
+  static constexpr std::size_t segment_size(std::size_t capacity) noexcept
+  {
+    return data_offset + capacity;
+  }
+
+  static constexpr std::size_t align(std::size_t sz) noexcept
+  {
+    return (sz + 7) & ~std::size_t(7);
+  }
+
+  shm_ring() = default;
+
+  //! Sets up a new ring in mem, by the process which will read it
+  static shm_ring
+  create(void* mem, std::size_t capacity, uint32_t owner) noexcept
+  {
+    shm_ring r;
+    r.m_header = static_cast<header*>(mem);
+    r.m_data = static_cast<char*>(mem) + data_offset;
+    r.m_capacity = capacity;
+
+    auto& h = *r.m_header;
+    h.magic.store(0, std::memory_order_relaxed);
+    std::memset(r.m_data, 0, capacity);
+    h.version = version;
+    h.capacity = capacity;
+    h.owner = owner;
+    h.write_pos.store(0, std::memory_order_relaxed);
+    h.read_pos.store(0, std::memory_order_relaxed);
+    h.sequence.store(0, std::memory_order_relaxed);
+    h.waiting.store(0, std::memory_order_relaxed);
+    h.magic.store(magic, std::memory_order_release);
+    return r;
+  }
+
+  //! Attaches to the ring created by another process in mem.
+  //! Returns an invalid ring if the segment is not initialized.
+  static shm_ring open(void* mem, std::size_t size) noexcept
+  {
+    shm_ring r;
+    auto h = static_cast<header*>(mem);
+    if (size < data_offset || h->magic.load(std::memory_order_acquire) != magic
+        || h->version != version
+        || segment_size(h->capacity) > size)
+      return r;
+
+    r.m_header = h;
+    r.m_data = static_cast<char*>(mem) + data_offset;
+    r.m_capacity = h->capacity;
+    return r;
+  }
+
+  explicit operator bool() const noexcept
+  {
+    return m_header;
+  }
+
+  //! Marks the ring as abandoned by its reader
+  void close() noexcept
+  {
+    m_header->magic.store(0, std::memory_order_release);
+  }
+
+  //! False once the reader has closed the ring
+  bool is_open() const noexcept
+  {
+    return m_header->magic.load(std::memory_order_relaxed) == magic;
+  }
+
+  uint32_t owner() const noexcept
+  {
+    return m_header->owner;
+  }
+
+  //! Largest packet which can be written in the ring
+  std::size_t max_packet_size() const noexcept
+  {
+    return m_capacity / 4;
+  }
+
+  /**
+   * @brief Copies a packet in the ring
+   *
+   * @return false if the packet is too large or there is not enough free
+   * space. If wake is set to true, the reader is sleeping and must be woken
+   * up.
+   */
+  bool write(const char* data, std::size_t sz, bool& wake) noexcept
+  {
+    wake = false;
+    if (sz == 0 || sz > max_packet_size())
+      return false;
+
+    auto& h = *m_header;
+    const uint64_t total = align(4 + sz);
+    uint64_t pos = h.write_pos.load(std::memory_order_relaxed);
+    do
+    {
+      if (pos + total - h.read_pos.load(std::memory_order_acquire)
+          > m_capacity)
+        return false;
+    } while (!h.write_pos.compare_exchange_weak(
+        pos, pos + total, std::memory_order_relaxed));
+
+    size_word(pos).store(uint32_t(sz) | pending, std::memory_order_relaxed);
+    copy_in(pos + 4, data, sz);
+    size_word(pos).store(uint32_t(sz), std::memory_order_release);
+
+    h.sequence.fetch_add(1, std::memory_order_seq_cst);
+    wake = h.waiting.load(std::memory_order_seq_cst) != 0;
+    return true;
+  }
+
+  /**
+   * @brief Reads the next packet, if it has been published
+   *
+   * f(const char* data, std::size_t size) is called with the packet; the
+   * buffer is used when the packet wraps around the end of the ring.
+   *
+   * @return false if there is no published packet to read, or if the ring
+   * is broken.
+   */
+  template <typename F, typename Buffer>
+  bool read(Buffer& buffer, F&& f)
+  {
+    auto& h = *m_header;
+    const uint64_t pos = h.read_pos.load(std::memory_order_relaxed);
+    const uint32_t word = size_word(pos).load(std::memory_order_acquire);
+    if (word == 0 || (word & pending))
+    {
+      if (stalled(pos))
+        m_broken = true;
+      return false;
+    }
+
+    const uint32_t sz = word;
+    if (!valid(pos, sz))
+    {
+      m_broken = true;
+      return false;
+    }
+
+    const uint64_t total = align(4 + sz);
+    const std::size_t begin = (pos + 4) & (m_capacity - 1);
+    if (begin + sz <= m_capacity)
+    {
+      f(m_data + begin, std::size_t(sz));
+    }
+    else
+    {
+      buffer.resize(sz);
+      copy_out(pos + 4, buffer.data(), sz);
+      f(buffer.data(), std::size_t(sz));
+    }
+
+    clear(pos, total);
+    h.read_pos.store(pos + total, std::memory_order_release);
+    return true;
+  }
+
+  //! Whether the reader found an abandoned or invalid record : the ring
+  //! cannot be read anymore and has to be replaced.
+  bool broken() const noexcept
+  {
+    return m_broken;
+  }
+
+  //! Word on which the reader sleeps
+  std::atomic<uint32_t>& wait_word() noexcept
+  {
+    return m_header->sequence;
+  }
+
+  /**
+   * @brief Announces that the reader is going to sleep
+   *
+   * @return the value of wait_word() to wait on, and whether the ring is
+   * still empty: if not, the reader must not sleep.
+   */
+  bool prepare_wait(uint32_t& seq) noexcept
+  {
+    auto& h = *m_header;
+    h.waiting.store(1, std::memory_order_seq_cst);
+    seq = h.sequence.load(std::memory_order_seq_cst);
+    const uint64_t pos = h.read_pos.load(std::memory_order_relaxed);
+    const uint32_t word = size_word(pos).load(std::memory_order_acquire);
+    return word == 0 || (word & pending);
+  }
+
+  void end_wait() noexcept
+  {
+    m_header->waiting.store(0, std::memory_order_relaxed);
+  }
+
+private:
+  //! Whether the record at pos is in the ring and fits before the write
+  //! position
+  bool valid(uint64_t pos, uint32_t sz) const noexcept
+  {
+    return sz <= max_packet_size()
+           && pos + align(4 + sz)
+                  <= m_header->write_pos.load(std::memory_order_acquire);
+  }
+
+  //! Whether the record at pos has been reserved but left unpublished for
+  //! longer than stall_timeout
+  bool stalled(uint64_t pos) noexcept
+  {
+    if (m_header->write_pos.load(std::memory_order_acquire) == pos)
+      return false;
+
+    const auto now = std::chrono::steady_clock::now();
+    if (pos != m_stallPos)
+    {
+      m_stallPos = pos;
+      m_stallSince = now;
+      return false;
+    }
+    return now - m_stallSince > stall_timeout;
+  }
+
+  std::atomic<uint32_t>& size_word(uint64_t pos) noexcept
+  {
+    // Records are 8-byte aligned hence the header never wraps
+    return *reinterpret_cast<std::atomic<uint32_t>*>(
+        m_data + (pos & (m_capacity - 1)));
+  }
+
+  void copy_in(uint64_t pos, const char* src, std::size_t sz) noexcept
+  {
+    const std::size_t begin = pos & (m_capacity - 1);
+    const std::size_t first = std::min(sz, m_capacity - begin);
+    std::memcpy(m_data + begin, src, first);
+    std::memcpy(m_data, src + first, sz - first);
+  }
+
+  void copy_out(uint64_t pos, char* dst, std::size_t sz) const noexcept
+  {
+    const std::size_t begin = pos & (m_capacity - 1);
+    const std::size_t first = std::min(sz, m_capacity - begin);
+    std::memcpy(dst, m_data + begin, first);
+    std::memcpy(dst + first, m_data, sz - first);
+  }
+
+  void clear(uint64_t pos, std::size_t sz) noexcept
+  {
+    const std::size_t begin = pos & (m_capacity - 1);
+    const std::size_t first = std::min(sz, m_capacity - begin);
+    std::memset(m_data + begin, 0, first);
+    std::memset(m_data, 0, sz - first);
+  }
+
+  header* m_header{};
+  char* m_data{};
+  std::size_t m_capacity{};
+
+  // Reader state
+  uint64_t m_stallPos{~uint64_t(0)};
+  std::chrono::steady_clock::time_point m_stallSince{};
+  bool m_broken{};
+};
+}
+}
@@ -0,0 +1,586 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <ossia/detail/logger.hpp>
+#include <ossia/network/base/device.hpp>
+#include <ossia/network/base/parameter.hpp>
+#include <ossia/network/common/packet_logger.hpp>
+#include <ossia/network/common/pattern_match_cache.hpp>
+#include <ossia/network/exceptions.hpp>
+#include <ossia/network/osc/detail/bundle.hpp>
+#include <ossia/network/osc/detail/message_generator.hpp>
+#include <ossia/network/osc/detail/osc.hpp>
+#include <ossia/network/osc/detail/osc_receive.hpp>
+#include <ossia/network/shm/detail/shm_ring.hpp>
+#include <ossia/network/shm/shm_protocol.hpp>
+#include <ossia/network/value/format_value.hpp>
+
+#include <oscpack/osc/OscReceivedElements.h>
+
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <ctime>
+#endif
+#endif
+
+namespace ossia
+{
+namespace net
+{
+namespace
+{
+// Delay before trying again to open the segment of the remote side
+constexpr auto reopen_interval = std::chrono::milliseconds(500);
+
+// The receive thread wakes up at least this often to check if it must stop
+constexpr auto max_wait = std::chrono::milliseconds(100);
+
+std::size_t ring_capacity(std::size_t n)
+{
+  std::size_t res = 4096;
+  while (res < n)
+    res *= 2;
+  return res;
+}
+}
+
+/**
+ * A shared memory segment holding a ring, and the means to wake up its
+ * reader.
+ */
+struct shm_protocol::segment
+{
+  /**
+   * Creates the segment read by this process.
+   *
+   * Throws if another process already reads a segment with this name.
+   * On POSIX, a segment left by a process which crashed is replaced.
+   */
+  static std::unique_ptr<segment>
+  create(const std::string& name, std::size_t capacity)
+  {
+    auto seg = std::unique_ptr<segment>(new segment{name, true});
+    const std::size_t sz = shm_ring::segment_size(capacity);
+#if defined(_WIN32)
+    seg->m_mapping = CreateFileMappingA(
+        INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, DWORD(uint64_t(sz) >> 32),
+        DWORD(sz & 0xFFFFFFFF), seg->mapping_name().c_str());
+    if (!seg->m_mapping)
+      seg->fail("CreateFileMapping failed");
+    if (GetLastError() == ERROR_ALREADY_EXISTS)
+    {
+      // Not owned: the destructor must not close the ring of the other side
+      seg->m_owner = false;
+      seg->fail("already in use");
+    }
+    seg->m_mem = MapViewOfFile(seg->m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, sz);
+    if (!seg->m_mem)
+      seg->fail("MapViewOfFile failed");
+    seg->m_event
+        = CreateEventA(nullptr, FALSE, FALSE, seg->event_name().c_str());
+    if (!seg->m_event)
+      seg->fail("CreateEvent failed");
+    const uint32_t owner = GetCurrentProcessId();
+#else
+    const auto path = seg->mapping_name();
+    seg->m_fd = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (seg->m_fd < 0 && errno == EEXIST)
+    {
+      if (in_use(name))
+      {
+        seg->m_owner = false;
+        seg->fail("already in use");
+      }
+      shm_unlink(path.c_str());
+      seg->m_fd = shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    }
+    if (seg->m_fd < 0)
+    {
+      // Someone else created it meanwhile: it is not ours to unlink
+      seg->m_owner = false;
+      seg->fail(std::strerror(errno));
+    }
+    if (ftruncate(seg->m_fd, off_t(sz)) != 0)
+      seg->fail(std::strerror(errno));
+    if (!seg->map(sz))
+      seg->fail(std::strerror(errno));
+    const uint32_t owner = uint32_t(getpid());
+#endif
+    seg->m_size = sz;
+    seg->ring = shm_ring::create(seg->m_mem, capacity, owner);
+    return seg;
+  }
+
+  //! Opens the segment of another process, if it exists
+  static std::unique_ptr<segment> open(const std::string& name)
+  {
+    auto seg = std::unique_ptr<segment>(new segment{name, false});
+#if defined(_WIN32)
+    seg->m_mapping = OpenFileMappingA(
+        FILE_MAP_ALL_ACCESS, FALSE, seg->mapping_name().c_str());
+    if (!seg->m_mapping)
+      return nullptr;
+    seg->m_mem = MapViewOfFile(seg->m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (!seg->m_mem)
+      return nullptr;
+
+    MEMORY_BASIC_INFORMATION info{};
+    if (!VirtualQuery(seg->m_mem, &info, sizeof(info)))
+      return nullptr;
+    seg->m_size = info.RegionSize;
+
+    seg->m_event = OpenEventA(
+        EVENT_MODIFY_STATE | SYNCHRONIZE, FALSE, seg->event_name().c_str());
+    if (!seg->m_event)
+      return nullptr;
+#else
+    seg->m_fd = shm_open(seg->mapping_name().c_str(), O_RDWR, 0600);
+    if (seg->m_fd < 0)
+      return nullptr;
+
+    struct stat st;
+    if (fstat(seg->m_fd, &st) != 0)
+      return nullptr;
+    if (!seg->map(std::size_t(st.st_size)))
+      return nullptr;
+#endif
+    seg->ring = shm_ring::open(seg->m_mem, seg->m_size);
+    if (!seg->ring)
+      return nullptr;
+    return seg;
+  }
+
+  ~segment()
+  {
+    if (m_owner && ring)
+      ring.close();
+
+#if defined(_WIN32)
+    if (m_event)
+      CloseHandle(m_event);
+    if (m_mem)
+      UnmapViewOfFile(m_mem);
+    if (m_mapping)
+      CloseHandle(m_mapping);
+#else
+    if (m_mem)
+      munmap(m_mem, m_size);
+    if (m_fd >= 0)
+      close(m_fd);
+    if (m_owner)
+      shm_unlink(mapping_name().c_str());
+#endif
+  }
+
+  //! Wakes up the reader
+  void wake() noexcept
+  {
+#if defined(_WIN32)
+    SetEvent(m_event);
+#elif defined(__linux__)
+    // Not FUTEX_WAKE_PRIVATE: the word is shared between processes
+    syscall(SYS_futex, &ring.wait_word(), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#endif
+  }
+
+  //! Sleeps until wake() is called, as long as the ring sequence is seq
+  void wait(uint32_t seq) noexcept
+  {
+#if defined(_WIN32)
+    (void)seq;
+    WaitForSingleObject(m_event, DWORD(max_wait.count()));
+#elif defined(__linux__)
+    timespec timeout{0, long(std::chrono::nanoseconds(max_wait).count())};
+    syscall(
+        SYS_futex, &ring.wait_word(), FUTEX_WAIT, seq, &timeout, nullptr, 0);
+#else
+    // No portable process-shared wait on a memory word: poll
+    (void)seq;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+#endif
+  }
+
+  shm_ring ring;
+
+private:
+  segment(const std::string& name, bool owner) : m_name{name}, m_owner{owner}
+  {
+  }
+
+  [[noreturn]] void fail(const char* reason) const
+  {
+    throw ossia::connection_error{
+        "shm_protocol: Could not create shared memory segment: " + m_name
+        + ": " + reason};
+  }
+
+#if !defined(_WIN32)
+  //! Whether the existing segment with this name is read by a live process
+  static bool in_use(const std::string& name)
+  {
+    auto seg = open(name);
+    if (!seg || !seg->ring.is_open())
+      return false;
+    return kill(pid_t(seg->ring.owner()), 0) == 0 || errno == EPERM;
+  }
+#endif
+
+  std::string mapping_name() const
+  {
+#if defined(_WIN32)
+    return "Local\\ossia.shm." + m_name;
+#else
+    return "/ossia.shm." + m_name;
+#endif
+  }
+
+#if defined(_WIN32)
+  std::string event_name() const
+  {
+    return "Local\\ossia.shm." + m_name + ".event";
+  }
+#else
+  bool map(std::size_t sz)
+  {
+    void* mem
+        = mmap(nullptr, sz, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (mem == MAP_FAILED)
+      return false;
+    m_mem = mem;
+    m_size = sz;
+    return true;
+  }
+#endif
+
+  std::string m_name;
+  void* m_mem{};
+  std::size_t m_size{};
+  bool m_owner{};
+
+#if defined(_WIN32)
+  HANDLE m_mapping{};
+  HANDLE m_event{};
+#else
+  int m_fd{-1};
+#endif
+};
+
+shm_protocol::shm_protocol(
+    std::string local_name, std::string remote_name, std::size_t capacity)
+    : m_bundle{std::make_unique<bundle_encoder>()}
+    , m_localName{std::move(local_name)}
+    , m_remoteName{std::move(remote_name)}
+{
+  m_capacity = ring_capacity(capacity);
+  m_inbound = segment::create(m_localName, m_capacity);
+
+  // Bundles are read in a single record
+  m_bundle->set_max_size(m_capacity / 4);
+}
+
+shm_protocol::~shm_protocol()
+{
+  stop();
+}
+
+const std::string& shm_protocol::get_local_name() const
+{
+  return m_localName;
+}
+
+const std::string& shm_protocol::get_remote_name() const
+{
+  return m_remoteName;
+}
+
+uint64_t shm_protocol::dropped_outbound() const
+{
+  return m_dropped.load(std::memory_order_relaxed);
+}
+
+void shm_protocol::stop()
+{
+  if (m_thread.joinable())
+  {
+    m_running = false;
+    {
+      ossia::lock_t lck{m_inboundMutex};
+      if (m_inbound)
+        m_inbound->wake();
+    }
+    m_thread.join();
+  }
+}
+
+bool shm_protocol::update(ossia::net::node_base& node)
+{
+  return false;
+}
+
+bool shm_protocol::pull(ossia::net::parameter_base& address)
+{
+  return false;
+}
+
+bool shm_protocol::push(
+    const ossia::net::parameter_base& addr, const ossia::value& v)
+{
+  if (addr.get_access() == ossia::access_mode::GET)
+    return false;
+
+  auto val = filter_value(addr, v);
+  if (val.valid())
+    return send_message(addr.get_node().osc_address(), val);
+  return false;
+}
+
+bool shm_protocol::push_encoded(encoded_message& msg)
+{
+  return write_encoded(
+      msg, m_logger, [this](const char* data, std::size_t sz) {
+        return send(data, sz);
+      });
+}
+
+bool shm_protocol::push_raw(const ossia::net::full_parameter_data& addr)
+{
+  if (addr.get_access() == ossia::access_mode::GET)
+    return false;
+
+  auto val = filter_value(addr, addr.value());
+  if (val.valid())
+    return send_message(addr.address, val);
+  return false;
+}
+
+bool shm_protocol::push_bundle(
+    const std::vector<const parameter_base*>& addresses)
+{
+  ossia::lock_t lck{m_bundleMutex};
+  return write_bundle(
+      *m_bundle, addresses, [this](const char* data, std::size_t sz) {
+        return send(data, sz);
+      });
+}
+
+bool shm_protocol::push_bundle_values(
+    const std::vector<std::pair<const parameter_base*, ossia::value>>& values)
+{
+  ossia::lock_t lck{m_bundleMutex};
+  return write_bundle_values(
+      *m_bundle, values, [this](const char* data, std::size_t sz) {
+        return send(data, sz);
+      });
+}
+
+bool shm_protocol::push_raw_bundle(
+    const std::vector<ossia::net::full_parameter_data>& addresses)
+{
+  ossia::lock_t lck{m_bundleMutex};
+  return write_raw_bundle(
+      *m_bundle, addresses, [this](const char* data, std::size_t sz) {
+        return send(data, sz);
+      });
+}
+
+bool shm_protocol::observe(ossia::net::parameter_base& address, bool enable)
+{
+  if (enable)
+    m_listening.insert(
+        std::make_pair(address.get_node().osc_address(), &address));
+  else
+    m_listening.erase(address.get_node().osc_address());
+
+  return true;
+}
+
+bool shm_protocol::send_message(
+    ossia::string_view address, const ossia::value& val)
+{
+  bool ok = false;
+  try
+  {
+    oscpack::MessageGenerator<osc_outbound_visitor> m;
+    const auto& str = m(address, val);
+    ok = send(str.Data(), str.Size());
+  }
+  catch (const oscpack::OutOfBufferMemoryException&)
+  {
+    oscpack::DynamicMessageGenerator<osc_outbound_visitor> m;
+    const auto& str = m(address, val);
+    ok = send(str.Data(), str.Size());
+  }
+
+  if (m_logger.outbound_logger && !m_logger.packet_log)
+    m_logger.outbound_logger->info("Out: {} {}", address, val);
+  return ok;
+}
+
+bool shm_protocol::send(const char* data, std::size_t sz)
+{
+  if (m_logger.packet_log)
+    m_logger.packet_log->log(packet_logger::outbound, data, sz);
+
+  ossia::lock_t lck{m_remoteMutex};
+  if (!m_remote || !m_remote->ring.is_open())
+  {
+    if (!open_remote())
+    {
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+  }
+
+  bool wake{};
+  if (!m_remote->ring.write(data, sz, wake))
+  {
+    // The remote process may have crashed, leaving a segment nobody reads
+    if (sz <= m_remote->ring.max_packet_size()
+        && std::chrono::steady_clock::now() - m_lastOpenAttempt
+               > reopen_interval)
+      m_remote.reset();
+
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  if (wake)
+    m_remote->wake();
+  return true;
+}
+
+bool shm_protocol::open_remote()
+{
+  const auto now = std::chrono::steady_clock::now();
+  if (now - m_lastOpenAttempt < reopen_interval)
+    return false;
+
+  m_lastOpenAttempt = now;
+  m_remote = segment::open(m_remoteName);
+  return bool(m_remote);
+}
+
+void shm_protocol::run()
+{
+  std::vector<char> buffer;
+  auto handle
+      = [this](const char* data, std::size_t sz) { on_received_packet(data, sz); };
+
+  while (m_running)
+  {
+    if (!m_inbound && !replace_inbound())
+      return;
+
+    auto& ring = m_inbound->ring;
+    bool received = false;
+    while (ring.read(buffer, handle))
+      received = true;
+
+    if (ring.broken())
+    {
+      // A writer which is only slow may still write in its record: the
+      // space cannot be reused. The writers open the new segment once they
+      // see that the old one is closed.
+      ossia::logger().warn(
+          "shm_protocol: abandoned or invalid record in {}, replacing the "
+          "segment",
+          m_localName);
+      ossia::lock_t lck{m_inboundMutex};
+      m_inbound.reset();
+      continue;
+    }
+
+    if (received)
+      continue;
+
+    uint32_t seq{};
+    if (ring.prepare_wait(seq) && m_running)
+      m_inbound->wait(seq);
+    ring.end_wait();
+  }
+}
+
+bool shm_protocol::replace_inbound()
+{
+  while (m_running)
+  {
+    try
+    {
+      auto seg = segment::create(m_localName, m_capacity);
+      ossia::lock_t lck{m_inboundMutex};
+      m_inbound = std::move(seg);
+      return true;
+    }
+    catch (const std::exception& e)
+    {
+      // On Windows, the name is only free once the writers have closed it
+      ossia::logger().error("shm_protocol: {}", e.what());
+      std::this_thread::sleep_for(reopen_interval);
+    }
+  }
+  return false;
+}
+
+void shm_protocol::on_received_packet(const char* data, std::size_t sz)
+{
+  try
+  {
+    oscpack::ReceivedPacket p{data, (oscpack::osc_bundle_element_size_t)sz};
+    if (p.IsBundle())
+      on_received_bundle(oscpack::ReceivedBundle{p});
+    else
+      on_received_message(oscpack::ReceivedMessage{p});
+  }
+  catch (std::exception& e)
+  {
+    ossia::logger().error(
+        "shm_protocol::on_received_packet error: {}", e.what());
+  }
+  catch (...)
+  {
+    ossia::logger().error("shm_protocol::on_received_packet error");
+  }
+}
+
+void shm_protocol::on_received_bundle(const oscpack::ReceivedBundle& b)
+{
+  for (auto it = b.ElementsBegin(); it != b.ElementsEnd(); ++it)
+  {
+    if (it->IsBundle())
+      on_received_bundle(oscpack::ReceivedBundle{*it});
+    else
+      on_received_message(oscpack::ReceivedMessage{*it});
+  }
+}
+
+void shm_protocol::on_received_message(const oscpack::ReceivedMessage& m)
+{
+  handle_osc_message<false>(
+      m, m_listening, *m_device, m_logger, m_patterns.get());
+}
+
+void shm_protocol::set_device(device_base& dev)
+{
+  stop();
+
+  m_patterns.reset();
+  m_device = &dev;
+  m_patterns = std::make_unique<pattern_match_cache>(dev);
+
+  m_running = true;
+  m_thread = std::thread{[this] { run(); }};
+}
+}
+}
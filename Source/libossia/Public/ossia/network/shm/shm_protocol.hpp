@@ -0,0 +1,138 @@
+#pragma once
+#include <ossia/detail/mutex.hpp>
+#include <ossia/detail/string_view.hpp>
+#include <ossia/network/base/listening.hpp>
+#include <ossia/network/base/protocol.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace oscpack
+{
+class ReceivedMessage;
+class ReceivedBundle;
+}
+namespace ossia
+{
+namespace net
+{
+class bundle_encoder;
+class pattern_match_cache;
+
+/**
+ * @brief OSC over shared memory, between processes of the same host
+ *
+ * Each side owns a shared memory segment named after local_name, in which
+ * the other processes write OSC packets; packets are sent by writing them
+ * in the segment of remote_name. Hence two processes communicate with
+ * swapped names:
+ * \code
+ * // Process A
+ * shm_protocol{"a", "b"};
+ * // Process B
+ * shm_protocol{"b", "a"};
+ * \endcode
+ *
+ * The segments are lock-free rings: sending a packet is a copy, without
+ * system call unless the receiver is sleeping. The receive thread sleeps on
+ * a futex on Linux, a named event on Windows, and polls every millisecond
+ * on other platforms.
+ *
+ * The remote segment is opened when the first packet is sent, and again
+ * later if the remote process was not started yet, or if it replaced its
+ * segment because a writer abandoned a record in it. Packets which cannot
+ * be written, because the remote ring is full or does not exist, are
+ * dropped and counted.
+ */
+class OSSIA_EXPORT shm_protocol final : public ossia::net::protocol_base
+{
+public:
+  static constexpr std::size_t default_capacity = 1 << 20;
+
+  /**
+   * @param capacity Size in bytes of the local ring, rounded up to a power
+   * of two. Packets larger than a quarter of the ring of the remote side
+   * cannot be sent.
+   */
+  shm_protocol(
+      std::string local_name, std::string remote_name,
+      std::size_t capacity = default_capacity);
+
+  shm_protocol(const shm_protocol&) = delete;
+  shm_protocol(shm_protocol&&) = delete;
+  shm_protocol& operator=(const shm_protocol&) = delete;
+  shm_protocol& operator=(shm_protocol&&) = delete;
+
+  ~shm_protocol() override;
+
+  const std::string& get_local_name() const;
+  const std::string& get_remote_name() const;
+
+  //! Packets which could not be written in the remote segment
+  uint64_t dropped_outbound() const;
+
+  bool update(ossia::net::node_base& node_base) override;
+
+  bool pull(ossia::net::parameter_base& parameter_base) override;
+
+  bool push(
+      const ossia::net::parameter_base& parameter_base,
+      const ossia::value& v) override;
+  bool
+  push_raw(const ossia::net::full_parameter_data& parameter_base) override;
+  bool
+  push_bundle(const std::vector<const ossia::net::parameter_base*>&) override;
+  bool push_bundle_values(
+      const std::vector<std::pair<const parameter_base*, ossia::value>>&)
+      override;
+  bool push_encoded(encoded_message&) override;
+  bool push_raw_bundle(const std::vector<full_parameter_data>&) override;
+
+  bool
+  observe(ossia::net::parameter_base& parameter_base, bool enable) override;
+
+  void stop() override;
+
+private:
+  struct segment;
+
+  void set_device(ossia::net::device_base& dev) override;
+
+  bool send_message(ossia::string_view address, const ossia::value& val);
+  bool send(const char* data, std::size_t sz);
+  bool open_remote();
+
+  void run();
+  bool replace_inbound();
+  void on_received_packet(const char* data, std::size_t sz);
+  void on_received_bundle(const oscpack::ReceivedBundle& b);
+  void on_received_message(const oscpack::ReceivedMessage& m);
+
+  listened_parameters m_listening;
+  std::unique_ptr<pattern_match_cache> m_patterns;
+
+  // Replaced by the receive thread when its ring is broken
+  ossia::mutex_t m_inboundMutex;
+  std::unique_ptr<segment> m_inbound;
+  std::size_t m_capacity{};
+
+  ossia::mutex_t m_remoteMutex;
+  std::unique_ptr<segment> m_remote;
+  std::chrono::steady_clock::time_point m_lastOpenAttempt{};
+  std::atomic<uint64_t> m_dropped{};
+
+  ossia::mutex_t m_bundleMutex;
+  std::unique_ptr<bundle_encoder> m_bundle;
+
+  ossia::net::device_base* m_device{};
+  std::string m_localName;
+  std::string m_remoteName;
+
+  std::atomic_bool m_running{};
+  std::thread m_thread;
+};
+}
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include <ossia/detail/cow_ptr.hpp>
 #include <ossia/detail/destination_index.hpp>
 #include <ossia/detail/string_view.hpp>
 #include <ossia/network/common/parameter_properties.hpp>
@@ -19,9 +19,9 @@ public:
 
     bool m_value6;
 
-    std::string m_value7;
+    ossia::cow_ptr<std::string> m_value7;
 
-    std::vector<ossia::value> m_value8;
+    ossia::cow_ptr<std::vector<ossia::value>> m_value8;
 
     char m_value9;
 
@@ -54,10 +54,10 @@ public:
     switch (m_type)
     {
       case Type::Type7:
-        m_impl.m_value7.~basic_string();
+        m_impl.m_value7.~cow_ptr();
         break;
       case Type::Type8:
-        m_impl.m_value8.~vector<ossia::value>();
+        m_impl.m_value8.~cow_ptr();
         break;
       default:
         break;
@@ -125,19 +125,19 @@ public:
   }
   value_variant_type(const std::string& v) : m_type{Type7}
   {
-    new (&m_impl.m_value7) std::string{v};
+    new (&m_impl.m_value7) ossia::cow_ptr<std::string>{v};
   }
   value_variant_type(std::string&& v) : m_type{Type7}
   {
-    new (&m_impl.m_value7) std::string{std::move(v)};
+    new (&m_impl.m_value7) ossia::cow_ptr<std::string>{std::move(v)};
   }
   value_variant_type(const std::vector<ossia::value>& v) : m_type{Type8}
   {
-    new (&m_impl.m_value8) std::vector<ossia::value>{v};
+    new (&m_impl.m_value8) ossia::cow_ptr<std::vector<ossia::value>>{v};
   }
   value_variant_type(std::vector<ossia::value>&& v) : m_type{Type8}
   {
-    new (&m_impl.m_value8) std::vector<ossia::value>{std::move(v)};
+    new (&m_impl.m_value8) ossia::cow_ptr<std::vector<ossia::value>>{std::move(v)};
   }
   value_variant_type(char v) : m_type{Type9}
   {
@@ -169,11 +169,11 @@ public:
         new (&m_impl.m_value6) bool{other.m_impl.m_value6};
         break;
       case Type::Type7:
-        new (&m_impl.m_value7) std::string{other.m_impl.m_value7};
+        new (&m_impl.m_value7) ossia::cow_ptr<std::string>{other.m_impl.m_value7};
         break;
       case Type::Type8:
         new (&m_impl.m_value8)
-            std::vector<ossia::value>{other.m_impl.m_value8};
+            ossia::cow_ptr<std::vector<ossia::value>>{other.m_impl.m_value8};
         break;
       case Type::Type9:
         new (&m_impl.m_value9) char{other.m_impl.m_value9};
@@ -209,11 +209,11 @@ public:
         new (&m_impl.m_value6) bool{std::move(other.m_impl.m_value6)};
         break;
       case Type::Type7:
-        new (&m_impl.m_value7) std::string{std::move(other.m_impl.m_value7)};
+        new (&m_impl.m_value7) ossia::cow_ptr<std::string>{std::move(other.m_impl.m_value7)};
         break;
       case Type::Type8:
         new (&m_impl.m_value8)
-            std::vector<ossia::value>{std::move(other.m_impl.m_value8)};
+            ossia::cow_ptr<std::vector<ossia::value>>{std::move(other.m_impl.m_value8)};
         break;
       case Type::Type9:
         new (&m_impl.m_value9) char{std::move(other.m_impl.m_value9)};
@@ -250,11 +250,11 @@ public:
         new (&m_impl.m_value6) bool{other.m_impl.m_value6};
         break;
       case Type::Type7:
-        new (&m_impl.m_value7) std::string{other.m_impl.m_value7};
+        new (&m_impl.m_value7) ossia::cow_ptr<std::string>{other.m_impl.m_value7};
         break;
       case Type::Type8:
         new (&m_impl.m_value8)
-            std::vector<ossia::value>{other.m_impl.m_value8};
+            ossia::cow_ptr<std::vector<ossia::value>>{other.m_impl.m_value8};
         break;
       case Type::Type9:
         new (&m_impl.m_value9) char{other.m_impl.m_value9};
@@ -293,11 +293,11 @@ public:
         new (&m_impl.m_value6) bool{std::move(other.m_impl.m_value6)};
         break;
       case Type::Type7:
-        new (&m_impl.m_value7) std::string{std::move(other.m_impl.m_value7)};
+        new (&m_impl.m_value7) ossia::cow_ptr<std::string>{std::move(other.m_impl.m_value7)};
         break;
       case Type::Type8:
         new (&m_impl.m_value8)
-            std::vector<ossia::value>{std::move(other.m_impl.m_value8)};
+            ossia::cow_ptr<std::vector<ossia::value>>{std::move(other.m_impl.m_value8)};
         break;
       case Type::Type9:
         new (&m_impl.m_value9) char{std::move(other.m_impl.m_value9)};
@@ -361,14 +361,14 @@ template <>
 inline const std::string* value_variant_type::target() const
 {
   if (m_type == Type7)
-    return &m_impl.m_value7;
+    return &*m_impl.m_value7;
   return nullptr;
 }
 template <>
 inline const std::vector<ossia::value>* value_variant_type::target() const
 {
   if (m_type == Type8)
-    return &m_impl.m_value8;
+    return &*m_impl.m_value8;
   return nullptr;
 }
 template <>
@@ -431,14 +431,14 @@ template <>
 inline std::string* value_variant_type::target()
 {
   if (m_type == Type7)
-    return &m_impl.m_value7;
+    return &*m_impl.m_value7;
   return nullptr;
 }
 template <>
 inline std::vector<ossia::value>* value_variant_type::target()
 {
   if (m_type == Type8)
-    return &m_impl.m_value8;
+    return &*m_impl.m_value8;
   return nullptr;
 }
 template <>
@@ -501,14 +501,14 @@ template <>
 inline const std::string& value_variant_type::get() const
 {
   if (m_type == Type7)
-    return m_impl.m_value7;
+    return *m_impl.m_value7;
   throw std::runtime_error("value_variant: bad type");
 }
 template <>
 inline const std::vector<ossia::value>& value_variant_type::get() const
 {
   if (m_type == Type8)
-    return m_impl.m_value8;
+    return *m_impl.m_value8;
   throw std::runtime_error("value_variant: bad type");
 }
 template <>
@@ -571,14 +571,14 @@ template <>
 inline std::string& value_variant_type::get()
 {
   if (m_type == Type7)
-    return m_impl.m_value7;
+    return *m_impl.m_value7;
   throw std::runtime_error("value_variant: bad type");
 }
 template <>
 inline std::vector<ossia::value>& value_variant_type::get()
 {
   if (m_type == Type8)
-    return m_impl.m_value8;
+    return *m_impl.m_value8;
   throw std::runtime_error("value_variant: bad type");
 }
 template <>
@@ -608,9 +608,9 @@ auto apply_nonnull(Visitor&& functor, const value_variant_type& var)
     case value_variant_type::Type::Type6:
       return functor(var.m_impl.m_value6);
     case value_variant_type::Type::Type7:
-      return functor(var.m_impl.m_value7);
+      return functor(*var.m_impl.m_value7);
     case value_variant_type::Type::Type8:
-      return functor(var.m_impl.m_value8);
+      return functor(*var.m_impl.m_value8);
     case value_variant_type::Type::Type9:
       return functor(var.m_impl.m_value9);
     default:
@@ -637,9 +637,9 @@ auto apply_nonnull(Visitor&& functor, value_variant_type& var)
     case value_variant_type::Type::Type6:
       return functor(var.m_impl.m_value6);
     case value_variant_type::Type::Type7:
-      return functor(var.m_impl.m_value7);
+      return functor(*var.m_impl.m_value7);
     case value_variant_type::Type::Type8:
-      return functor(var.m_impl.m_value8);
+      return functor(*var.m_impl.m_value8);
     case value_variant_type::Type::Type9:
       return functor(var.m_impl.m_value9);
     default:
@@ -666,9 +666,9 @@ auto apply_nonnull(Visitor&& functor, value_variant_type&& var)
     case value_variant_type::Type::Type6:
       return functor(std::move(var.m_impl.m_value6));
     case value_variant_type::Type::Type7:
-      return functor(std::move(var.m_impl.m_value7));
+      return functor(std::move(*var.m_impl.m_value7));
     case value_variant_type::Type::Type8:
-      return functor(std::move(var.m_impl.m_value8));
+      return functor(std::move(*var.m_impl.m_value8));
     case value_variant_type::Type::Type9:
       return functor(std::move(var.m_impl.m_value9));
     default:
@@ -695,9 +695,9 @@ auto apply(Visitor&& functor, const value_variant_type& var)
     case value_variant_type::Type::Type6:
       return functor(var.m_impl.m_value6);
     case value_variant_type::Type::Type7:
-      return functor(var.m_impl.m_value7);
+      return functor(*var.m_impl.m_value7);
     case value_variant_type::Type::Type8:
-      return functor(var.m_impl.m_value8);
+      return functor(*var.m_impl.m_value8);
     case value_variant_type::Type::Type9:
       return functor(var.m_impl.m_value9);
     default:
@@ -724,9 +724,9 @@ auto apply(Visitor&& functor, value_variant_type& var)
     case value_variant_type::Type::Type6:
       return functor(var.m_impl.m_value6);
     case value_variant_type::Type::Type7:
-      return functor(var.m_impl.m_value7);
+      return functor(*var.m_impl.m_value7);
     case value_variant_type::Type::Type8:
-      return functor(var.m_impl.m_value8);
+      return functor(*var.m_impl.m_value8);
     case value_variant_type::Type::Type9:
       return functor(var.m_impl.m_value9);
     default:
@@ -753,9 +753,9 @@ auto apply(Visitor&& functor, value_variant_type&& var)
     case value_variant_type::Type::Type6:
       return functor(std::move(var.m_impl.m_value6));
     case value_variant_type::Type::Type7:
-      return functor(std::move(var.m_impl.m_value7));
+      return functor(std::move(*var.m_impl.m_value7));
     case value_variant_type::Type::Type8:
-      return functor(std::move(var.m_impl.m_value8));
+      return functor(std::move(*var.m_impl.m_value8));
     case value_variant_type::Type::Type9:
       return functor(std::move(var.m_impl.m_value9));
     default:
@@ -803,11 +803,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -851,11 +851,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -899,11 +899,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -947,11 +947,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -995,11 +995,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1043,11 +1043,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1091,11 +1091,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1111,43 +1111,43 @@ auto apply(
       {
         case value_variant_type::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case value_variant_type::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case value_variant_type::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         case value_variant_type::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value3);
         }
         case value_variant_type::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value4);
         }
         case value_variant_type::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value5);
         }
         case value_variant_type::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value6);
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value7, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value7, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value9);
         }
         default:
           throw std::runtime_error("value_variant: bad type");
@@ -1159,43 +1159,43 @@ auto apply(
       {
         case value_variant_type::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case value_variant_type::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case value_variant_type::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         case value_variant_type::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value3);
         }
         case value_variant_type::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value4);
         }
         case value_variant_type::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value5);
         }
         case value_variant_type::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value6);
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value8, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value8, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value9);
         }
         default:
           throw std::runtime_error("value_variant: bad type");
@@ -1235,11 +1235,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1294,11 +1294,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1342,11 +1342,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1390,11 +1390,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1438,11 +1438,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1486,11 +1486,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1534,11 +1534,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1582,11 +1582,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1602,43 +1602,43 @@ auto apply(
       {
         case value_variant_type::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case value_variant_type::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case value_variant_type::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         case value_variant_type::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value3);
         }
         case value_variant_type::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value4);
         }
         case value_variant_type::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value5);
         }
         case value_variant_type::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value6);
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value7, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value7, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value9);
         }
         default:
           throw std::runtime_error("value_variant: bad type");
@@ -1650,43 +1650,43 @@ auto apply(
       {
         case value_variant_type::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case value_variant_type::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case value_variant_type::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         case value_variant_type::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value3);
         }
         case value_variant_type::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value4);
         }
         case value_variant_type::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value5);
         }
         case value_variant_type::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value6);
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value8, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value8, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value9);
         }
         default:
           throw std::runtime_error("value_variant: bad type");
@@ -1726,11 +1726,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1785,11 +1785,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1833,11 +1833,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1881,11 +1881,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1929,11 +1929,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -1977,11 +1977,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -2025,11 +2025,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -2073,11 +2073,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -2093,43 +2093,43 @@ auto apply(
       {
         case value_variant_type::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case value_variant_type::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case value_variant_type::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         case value_variant_type::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value3);
         }
         case value_variant_type::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value4);
         }
         case value_variant_type::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value5);
         }
         case value_variant_type::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value6);
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value7, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value7, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value9);
         }
         default:
           throw std::runtime_error("value_variant: bad type");
@@ -2141,43 +2141,43 @@ auto apply(
       {
         case value_variant_type::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case value_variant_type::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case value_variant_type::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         case value_variant_type::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value3);
         }
         case value_variant_type::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value4);
         }
         case value_variant_type::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value5);
         }
         case value_variant_type::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value6);
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value8, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value8, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value9);
         }
         default:
           throw std::runtime_error("value_variant: bad type");
@@ -2217,11 +2217,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -2291,13 +2291,13 @@ auto apply(
         {
           return functor(
               std::move(arg0.m_impl.m_value0),
-              std::move(arg1.m_impl.m_value7));
+              std::move(*arg1.m_impl.m_value7));
         }
         case value_variant_type::Type::Type8:
         {
           return functor(
               std::move(arg0.m_impl.m_value0),
-              std::move(arg1.m_impl.m_value8));
+              std::move(*arg1.m_impl.m_value8));
         }
         case value_variant_type::Type::Type9:
         {
@@ -2359,13 +2359,13 @@ auto apply(
         {
           return functor(
               std::move(arg0.m_impl.m_value1),
-              std::move(arg1.m_impl.m_value7));
+              std::move(*arg1.m_impl.m_value7));
         }
         case value_variant_type::Type::Type8:
         {
           return functor(
               std::move(arg0.m_impl.m_value1),
-              std::move(arg1.m_impl.m_value8));
+              std::move(*arg1.m_impl.m_value8));
         }
         case value_variant_type::Type::Type9:
         {
@@ -2427,13 +2427,13 @@ auto apply(
         {
           return functor(
               std::move(arg0.m_impl.m_value2),
-              std::move(arg1.m_impl.m_value7));
+              std::move(*arg1.m_impl.m_value7));
         }
         case value_variant_type::Type::Type8:
         {
           return functor(
               std::move(arg0.m_impl.m_value2),
-              std::move(arg1.m_impl.m_value8));
+              std::move(*arg1.m_impl.m_value8));
         }
         case value_variant_type::Type::Type9:
         {
@@ -2495,13 +2495,13 @@ auto apply(
         {
           return functor(
               std::move(arg0.m_impl.m_value3),
-              std::move(arg1.m_impl.m_value7));
+              std::move(*arg1.m_impl.m_value7));
         }
         case value_variant_type::Type::Type8:
         {
           return functor(
               std::move(arg0.m_impl.m_value3),
-              std::move(arg1.m_impl.m_value8));
+              std::move(*arg1.m_impl.m_value8));
         }
         case value_variant_type::Type::Type9:
         {
@@ -2563,13 +2563,13 @@ auto apply(
         {
           return functor(
               std::move(arg0.m_impl.m_value4),
-              std::move(arg1.m_impl.m_value7));
+              std::move(*arg1.m_impl.m_value7));
         }
         case value_variant_type::Type::Type8:
         {
           return functor(
               std::move(arg0.m_impl.m_value4),
-              std::move(arg1.m_impl.m_value8));
+              std::move(*arg1.m_impl.m_value8));
         }
         case value_variant_type::Type::Type9:
         {
@@ -2631,13 +2631,13 @@ auto apply(
         {
           return functor(
               std::move(arg0.m_impl.m_value5),
-              std::move(arg1.m_impl.m_value7));
+              std::move(*arg1.m_impl.m_value7));
         }
         case value_variant_type::Type::Type8:
         {
           return functor(
               std::move(arg0.m_impl.m_value5),
-              std::move(arg1.m_impl.m_value8));
+              std::move(*arg1.m_impl.m_value8));
         }
         case value_variant_type::Type::Type9:
         {
@@ -2699,13 +2699,13 @@ auto apply(
         {
           return functor(
               std::move(arg0.m_impl.m_value6),
-              std::move(arg1.m_impl.m_value7));
+              std::move(*arg1.m_impl.m_value7));
         }
         case value_variant_type::Type::Type8:
         {
           return functor(
               std::move(arg0.m_impl.m_value6),
-              std::move(arg1.m_impl.m_value8));
+              std::move(*arg1.m_impl.m_value8));
         }
         case value_variant_type::Type::Type9:
         {
@@ -2724,61 +2724,61 @@ auto apply(
         case value_variant_type::Type::Type0:
         {
           return functor(
-              std::move(arg0.m_impl.m_value7),
+              std::move(*arg0.m_impl.m_value7),
               std::move(arg1.m_impl.m_value0));
         }
         case value_variant_type::Type::Type1:
         {
           return functor(
-              std::move(arg0.m_impl.m_value7),
+              std::move(*arg0.m_impl.m_value7),
               std::move(arg1.m_impl.m_value1));
         }
         case value_variant_type::Type::Type2:
         {
           return functor(
-              std::move(arg0.m_impl.m_value7),
+              std::move(*arg0.m_impl.m_value7),
               std::move(arg1.m_impl.m_value2));
         }
         case value_variant_type::Type::Type3:
         {
           return functor(
-              std::move(arg0.m_impl.m_value7),
+              std::move(*arg0.m_impl.m_value7),
               std::move(arg1.m_impl.m_value3));
         }
         case value_variant_type::Type::Type4:
         {
           return functor(
-              std::move(arg0.m_impl.m_value7),
+              std::move(*arg0.m_impl.m_value7),
               std::move(arg1.m_impl.m_value4));
         }
         case value_variant_type::Type::Type5:
         {
           return functor(
-              std::move(arg0.m_impl.m_value7),
+              std::move(*arg0.m_impl.m_value7),
               std::move(arg1.m_impl.m_value5));
         }
         case value_variant_type::Type::Type6:
         {
           return functor(
-              std::move(arg0.m_impl.m_value7),
+              std::move(*arg0.m_impl.m_value7),
               std::move(arg1.m_impl.m_value6));
         }
         case value_variant_type::Type::Type7:
         {
           return functor(
-              std::move(arg0.m_impl.m_value7),
-              std::move(arg1.m_impl.m_value7));
+              std::move(*arg0.m_impl.m_value7),
+              std::move(*arg1.m_impl.m_value7));
         }
         case value_variant_type::Type::Type8:
         {
           return functor(
-              std::move(arg0.m_impl.m_value7),
-              std::move(arg1.m_impl.m_value8));
+              std::move(*arg0.m_impl.m_value7),
+              std::move(*arg1.m_impl.m_value8));
         }
         case value_variant_type::Type::Type9:
         {
           return functor(
-              std::move(arg0.m_impl.m_value7),
+              std::move(*arg0.m_impl.m_value7),
               std::move(arg1.m_impl.m_value9));
         }
         default:
@@ -2792,61 +2792,61 @@ auto apply(
         case value_variant_type::Type::Type0:
         {
           return functor(
-              std::move(arg0.m_impl.m_value8),
+              std::move(*arg0.m_impl.m_value8),
               std::move(arg1.m_impl.m_value0));
         }
         case value_variant_type::Type::Type1:
         {
           return functor(
-              std::move(arg0.m_impl.m_value8),
+              std::move(*arg0.m_impl.m_value8),
               std::move(arg1.m_impl.m_value1));
         }
         case value_variant_type::Type::Type2:
         {
           return functor(
-              std::move(arg0.m_impl.m_value8),
+              std::move(*arg0.m_impl.m_value8),
               std::move(arg1.m_impl.m_value2));
         }
         case value_variant_type::Type::Type3:
         {
           return functor(
-              std::move(arg0.m_impl.m_value8),
+              std::move(*arg0.m_impl.m_value8),
               std::move(arg1.m_impl.m_value3));
         }
         case value_variant_type::Type::Type4:
         {
           return functor(
-              std::move(arg0.m_impl.m_value8),
+              std::move(*arg0.m_impl.m_value8),
               std::move(arg1.m_impl.m_value4));
         }
         case value_variant_type::Type::Type5:
         {
           return functor(
-              std::move(arg0.m_impl.m_value8),
+              std::move(*arg0.m_impl.m_value8),
               std::move(arg1.m_impl.m_value5));
         }
         case value_variant_type::Type::Type6:
         {
           return functor(
-              std::move(arg0.m_impl.m_value8),
+              std::move(*arg0.m_impl.m_value8),
               std::move(arg1.m_impl.m_value6));
         }
         case value_variant_type::Type::Type7:
         {
           return functor(
-              std::move(arg0.m_impl.m_value8),
-              std::move(arg1.m_impl.m_value7));
+              std::move(*arg0.m_impl.m_value8),
+              std::move(*arg1.m_impl.m_value7));
         }
         case value_variant_type::Type::Type8:
         {
           return functor(
-              std::move(arg0.m_impl.m_value8),
-              std::move(arg1.m_impl.m_value8));
+              std::move(*arg0.m_impl.m_value8),
+              std::move(*arg1.m_impl.m_value8));
         }
         case value_variant_type::Type::Type9:
         {
           return functor(
-              std::move(arg0.m_impl.m_value8),
+              std::move(*arg0.m_impl.m_value8),
               std::move(arg1.m_impl.m_value9));
         }
         default:
@@ -2903,13 +2903,13 @@ auto apply(
         {
           return functor(
               std::move(arg0.m_impl.m_value9),
-              std::move(arg1.m_impl.m_value7));
+              std::move(*arg1.m_impl.m_value7));
         }
         case value_variant_type::Type::Type8:
         {
           return functor(
               std::move(arg0.m_impl.m_value9),
-              std::move(arg1.m_impl.m_value8));
+              std::move(*arg1.m_impl.m_value8));
         }
         case value_variant_type::Type::Type9:
         {
@@ -2965,11 +2965,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value0, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value0, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -3013,11 +3013,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value1, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value1, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -3061,11 +3061,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value2, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value2, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -3109,11 +3109,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value3, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value3, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -3157,11 +3157,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value4, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value4, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -3205,11 +3205,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value5, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value5, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -3253,11 +3253,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value6, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value6, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -3273,43 +3273,43 @@ auto apply(
       {
         case value_variant_type::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value0);
         }
         case value_variant_type::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value1);
         }
         case value_variant_type::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value2);
         }
         case value_variant_type::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value3);
         }
         case value_variant_type::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value4);
         }
         case value_variant_type::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value5);
         }
         case value_variant_type::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value6);
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value7, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value7, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value7, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value7, arg1.m_impl.m_value9);
         }
         default:
           throw std::runtime_error("value_variant: bad type");
@@ -3321,43 +3321,43 @@ auto apply(
       {
         case value_variant_type::Type::Type0:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value0);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value0);
         }
         case value_variant_type::Type::Type1:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value1);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value1);
         }
         case value_variant_type::Type::Type2:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value2);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value2);
         }
         case value_variant_type::Type::Type3:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value3);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value3);
         }
         case value_variant_type::Type::Type4:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value4);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value4);
         }
         case value_variant_type::Type::Type5:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value5);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value5);
         }
         case value_variant_type::Type::Type6:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value6);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value6);
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value7);
+          return functor(*arg0.m_impl.m_value8, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value8);
+          return functor(*arg0.m_impl.m_value8, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
-          return functor(arg0.m_impl.m_value8, arg1.m_impl.m_value9);
+          return functor(*arg0.m_impl.m_value8, arg1.m_impl.m_value9);
         }
         default:
           throw std::runtime_error("value_variant: bad type");
@@ -3397,11 +3397,11 @@ auto apply(
         }
         case value_variant_type::Type::Type7:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value7);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value7);
         }
         case value_variant_type::Type::Type8:
         {
-          return functor(arg0.m_impl.m_value9, arg1.m_impl.m_value8);
+          return functor(arg0.m_impl.m_value9, *arg1.m_impl.m_value8);
         }
         case value_variant_type::Type::Type9:
         {
@@ -3476,13 +3476,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -3544,13 +3544,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -3612,13 +3612,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -3680,13 +3680,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -3748,13 +3748,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -3816,13 +3816,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -3884,13 +3884,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -3909,61 +3909,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -3977,61 +3977,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value0, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value0, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -4088,13 +4088,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value0, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -4164,13 +4164,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -4232,13 +4232,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -4300,13 +4300,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -4368,13 +4368,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -4436,13 +4436,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -4504,13 +4504,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -4572,13 +4572,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -4597,61 +4597,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -4665,61 +4665,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value1, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value1, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -4776,13 +4776,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value1, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -4852,13 +4852,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -4920,13 +4920,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -4988,13 +4988,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5056,13 +5056,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5124,13 +5124,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5192,13 +5192,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5260,13 +5260,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5285,61 +5285,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -5353,61 +5353,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value2, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value2, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -5464,13 +5464,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value2, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5540,13 +5540,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5608,13 +5608,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5676,13 +5676,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5744,13 +5744,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5812,13 +5812,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5880,13 +5880,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5948,13 +5948,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -5973,61 +5973,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -6041,61 +6041,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value3, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value3, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -6152,13 +6152,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value3, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -6228,13 +6228,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -6296,13 +6296,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -6364,13 +6364,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -6432,13 +6432,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -6500,13 +6500,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -6568,13 +6568,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -6636,13 +6636,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -6661,61 +6661,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -6729,61 +6729,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value4, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value4, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -6840,13 +6840,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value4, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -6916,13 +6916,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -6984,13 +6984,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7052,13 +7052,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7120,13 +7120,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7188,13 +7188,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7256,13 +7256,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7324,13 +7324,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7349,61 +7349,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -7417,61 +7417,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value5, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value5, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -7528,13 +7528,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value5, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7604,13 +7604,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7672,13 +7672,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7740,13 +7740,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7808,13 +7808,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7876,13 +7876,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -7944,13 +7944,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -8012,13 +8012,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -8037,61 +8037,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8105,61 +8105,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value6, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value6, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8216,13 +8216,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value6, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -8249,61 +8249,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value0,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value0,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8317,61 +8317,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value1,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value1,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8385,61 +8385,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value2,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value2,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8453,61 +8453,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value3,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value3,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8521,61 +8521,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value4,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value4,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8589,61 +8589,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value5,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value5,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8657,61 +8657,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value6,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value6,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8725,61 +8725,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8793,61 +8793,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value7, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8861,61 +8861,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value9,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value9,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value7, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value7, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -8937,61 +8937,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value0,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value0,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value0,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value0,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -9005,61 +9005,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value1,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value1,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value1,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value1,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -9073,61 +9073,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value2,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value2,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value2,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value2,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -9141,61 +9141,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value3,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value3,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value3,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value3,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -9209,61 +9209,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value4,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value4,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value4,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value4,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -9277,61 +9277,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value5,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value5,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value5,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value5,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -9345,61 +9345,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value6,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value6,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value6,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value6,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -9413,61 +9413,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value7,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -9481,61 +9481,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value8,
+                  *arg0.m_impl.m_value8, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -9549,61 +9549,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value9,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value9,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value8, arg1.m_impl.m_value9,
+                  *arg0.m_impl.m_value8, arg1.m_impl.m_value9,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -9668,13 +9668,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -9736,13 +9736,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -9804,13 +9804,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -9872,13 +9872,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -9940,13 +9940,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -10008,13 +10008,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -10076,13 +10076,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -10101,61 +10101,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value7,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -10169,61 +10169,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  arg0.m_impl.m_value9, arg1.m_impl.m_value8,
+                  arg0.m_impl.m_value9, *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -10280,13 +10280,13 @@ auto apply(
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   arg0.m_impl.m_value9, arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -10367,13 +10367,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -10435,13 +10435,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -10503,13 +10503,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -10571,13 +10571,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -10639,13 +10639,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -10707,13 +10707,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -10775,13 +10775,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -10800,61 +10800,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -10868,61 +10868,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value0), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -10979,13 +10979,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value0), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11055,13 +11055,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11123,13 +11123,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11191,13 +11191,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11259,13 +11259,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11327,13 +11327,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11395,13 +11395,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11463,13 +11463,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11488,61 +11488,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -11556,61 +11556,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value1), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -11667,13 +11667,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value1), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11743,13 +11743,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11811,13 +11811,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11879,13 +11879,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -11947,13 +11947,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12015,13 +12015,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12083,13 +12083,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12151,13 +12151,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12176,61 +12176,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -12244,61 +12244,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value2), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -12355,13 +12355,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value2), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12431,13 +12431,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12499,13 +12499,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12567,13 +12567,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12635,13 +12635,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12703,13 +12703,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12771,13 +12771,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12839,13 +12839,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -12864,61 +12864,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -12932,61 +12932,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value3), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -13043,13 +13043,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value3), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -13119,13 +13119,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -13187,13 +13187,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -13255,13 +13255,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -13323,13 +13323,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -13391,13 +13391,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -13459,13 +13459,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -13527,13 +13527,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -13552,61 +13552,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -13620,61 +13620,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value4), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -13731,13 +13731,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value4), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -13807,13 +13807,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -13875,13 +13875,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -13943,13 +13943,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14011,13 +14011,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14079,13 +14079,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14147,13 +14147,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14215,13 +14215,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14240,61 +14240,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -14308,61 +14308,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value5), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -14419,13 +14419,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value5), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14495,13 +14495,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14563,13 +14563,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14631,13 +14631,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14699,13 +14699,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14767,13 +14767,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14835,13 +14835,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14903,13 +14903,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -14928,61 +14928,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -14996,61 +14996,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value6), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15107,13 +15107,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value6), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -15140,61 +15140,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value0,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value0,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15208,61 +15208,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value1,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value1,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15276,61 +15276,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value2,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value2,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15344,61 +15344,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value3,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value3,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15412,61 +15412,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value4,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value4,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15480,61 +15480,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value5,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value5,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15548,61 +15548,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value6,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value6,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15616,61 +15616,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15684,61 +15684,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value7), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15752,61 +15752,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value9,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value9,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value7), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value7), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15828,61 +15828,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value0,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value0,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value0,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value0,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15896,61 +15896,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value1,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value1,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value1,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value1,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -15964,61 +15964,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value2,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value2,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value2,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value2,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -16032,61 +16032,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value3,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value3,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value3,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value3,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -16100,61 +16100,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value4,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value4,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value4,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value4,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -16168,61 +16168,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value5,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value5,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value5,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value5,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -16236,61 +16236,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value6,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value6,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value6,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value6,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -16304,61 +16304,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value7,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -16372,61 +16372,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value8,
+                  std::move(*arg0.m_impl.m_value8), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -16440,61 +16440,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value9,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value9,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value8), arg1.m_impl.m_value9,
+                  std::move(*arg0.m_impl.m_value8), arg1.m_impl.m_value9,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -16559,13 +16559,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value0,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -16627,13 +16627,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value1,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -16695,13 +16695,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value2,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -16763,13 +16763,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value3,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -16831,13 +16831,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value4,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -16899,13 +16899,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value5,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -16967,13 +16967,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value6,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
@@ -16992,61 +16992,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value7,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value7,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value7,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value7,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -17060,61 +17060,61 @@ auto apply(
             case value_variant_type::Type::Type0:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value0);
             }
             case value_variant_type::Type::Type1:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value1);
             }
             case value_variant_type::Type::Type2:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value2);
             }
             case value_variant_type::Type::Type3:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value3);
             }
             case value_variant_type::Type::Type4:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value4);
             }
             case value_variant_type::Type::Type5:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value5);
             }
             case value_variant_type::Type::Type6:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value6);
             }
             case value_variant_type::Type::Type7:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value7);
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value8,
-                  arg2.m_impl.m_value8);
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value8,
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {
               return functor(
-                  std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value8,
+                  std::move(arg0.m_impl.m_value9), *arg1.m_impl.m_value8,
                   arg2.m_impl.m_value9);
             }
             default:
@@ -17171,13 +17171,13 @@ auto apply(
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value7);
+                  *arg2.m_impl.m_value7);
             }
             case value_variant_type::Type::Type8:
             {
               return functor(
                   std::move(arg0.m_impl.m_value9), arg1.m_impl.m_value9,
-                  arg2.m_impl.m_value8);
+                  *arg2.m_impl.m_value8);
             }
             case value_variant_type::Type::Type9:
             {